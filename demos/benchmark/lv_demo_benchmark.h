@@ -50,6 +50,27 @@ extern "C" {
  */
 void lv_demo_benchmark(void);
 
+/**
+ * Get the number of benchmark scenes.
+ * @return          the number of scenes
+ */
+uint32_t lv_demo_benchmark_get_scene_count(void);
+
+/**
+ * Get the name of a benchmark scene.
+ * @param idx       index of the scene
+ * @return          the name of the scene or NULL if `idx` is invalid
+ */
+const char * lv_demo_benchmark_get_scene_name(uint32_t idx);
+
+/**
+ * Load a benchmark scene on the active screen.
+ * Unlike `lv_demo_benchmark()` it doesn't switch to the next scene and doesn't show any results,
+ * so the scene can be measured in a custom way, e.g. for a fixed number of frames.
+ * @param idx       index of the scene
+ */
+void lv_demo_benchmark_load_scene(uint32_t idx);
+
 /**********************
  *      MACROS
  **********************/
@@ -71,6 +71,7 @@ widgets = {
     "tabview": "Tabview",
     "textarea": "Textarea",
     "tileview": "Tileview",
+    "virtuallist": "Virtual List",
     "win": "Window",
 }
 
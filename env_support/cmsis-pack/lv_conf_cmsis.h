@@ -729,6 +729,8 @@
 
 #define LV_USE_TILEVIEW   1
 
+#define LV_USE_VIRTUALLIST 1
+
 #define LV_USE_WIN        1
 
 /*==================
@@ -153,6 +153,8 @@ void lv_example_textarea_3(void);
 
 void lv_example_tileview_1(void);
 
+void lv_example_virtuallist_1(void);
+
 void lv_example_win_1(void);
 
 /**********************
@@ -0,0 +1,43 @@
+#include "../../lv_examples.h"
+#if LV_USE_VIRTUALLIST && LV_USE_LABEL && LV_BUILD_EXAMPLES
+
+static void event_handler(lv_event_t * e)
+{
+    lv_obj_t * item = lv_event_get_target(e);
+    lv_obj_t * list = lv_obj_get_parent(item);
+    LV_LOG_USER("Clicked: item %" LV_PRIu32, lv_virtuallist_get_item_index(list, item));
+}
+
+static lv_obj_t * create_item(lv_obj_t * list)
+{
+    lv_obj_t * btn = lv_button_create(list);
+    lv_obj_add_event_cb(btn, event_handler, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t * label = lv_label_create(btn);
+    lv_obj_align(label, LV_ALIGN_LEFT_MID, 0, 0);
+
+    return btn;
+}
+
+static void bind_item(lv_obj_t * list, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(list);
+    lv_obj_t * label = lv_obj_get_child(item, 0);
+    lv_label_set_text_fmt(label, "Item %" LV_PRIu32, index);
+}
+
+/**
+ * Scroll through 10000 items with only a few item objects
+ */
+void lv_example_virtuallist_1(void)
+{
+    lv_obj_t * list = lv_virtuallist_create(lv_screen_active());
+    lv_obj_set_size(list, 180, 220);
+    lv_obj_center(list);
+
+    lv_virtuallist_set_item_height(list, 40);
+    lv_virtuallist_set_item_cb(list, create_item, bind_item);
+    lv_virtuallist_set_item_count(list, 10000);
+}
+
+#endif
@@ -81,6 +81,12 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /** Keep the freed small blocks (<= 256 bytes) in per-thread caches of size classes, so that
+     *  most `lv_malloc()`/`lv_free()` calls of small objects (draw tasks, descriptors, list nodes)
+     *  don't need to lock the heap. The maximum number of cached blocks per size class and thread.
+     *  0: disable. Only `LV_OS_NONE`, `LV_OS_PTHREAD` and `LV_OS_WINDOWS` are supported. */
+    #define LV_MEM_THREAD_CACHE 0
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -94,6 +100,17 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** Maximum number of separately refreshed areas of a display.
+ *  The buffer of the invalidated areas grows on demand up to this limit. Above it the new areas
+ *  are merged with the saved area which increases the refreshed area the least. */
+#define LV_INV_AREA_MAX_CNT 256
+
+/** Cost of refreshing and flushing an area separately, expressed in pixels.
+ *  Two invalidated areas are merged if their bounding box is smaller than their total size plus this cost.
+ *  Larger values mean fewer but larger areas to flush.
+ *  - 0: merge only if fewer pixels need to be refreshed */
+#define LV_INV_AREA_MERGE_COST 0    /**< [px] */
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -149,6 +166,19 @@
  */
 #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)         /**< [bytes]*/
 
+/** Tile size of the per-layer index of the draw tasks.
+ *  With more than one draw unit the unfinished draw tasks are bucketed into tiles of this size
+ *  so that the independent draw tasks can be found without checking all the older ones.
+ *  - 0: disable the index and check all the older draw tasks */
+#define LV_DRAW_TASK_INDEX_TILE_SIZE    64              /**< [px]*/
+
+/** Size of the chunks of the arena holding the draw tasks and their draw descriptors.
+ *  Instead of allocating them one by one on the heap they are taken from a bump allocator
+ *  whose chunk is reset in one step when all of its draw tasks are finished.
+ *  It should be large enough for the draw tasks of a typical frame.
+ *  - 0: allocate every draw task and descriptor with `lv_malloc()` */
+#define LV_DRAW_TASK_ARENA_SIZE         0               /**< [bytes]*/
+
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
     /*
@@ -166,12 +196,21 @@
     #define LV_DRAW_SW_SUPPORT_AL88         1
     #define LV_DRAW_SW_SUPPORT_A8           1
     #define LV_DRAW_SW_SUPPORT_I1           1
+    #define LV_DRAW_SW_SUPPORT_YUV          1   /**< I420, I422, I444, I400, NV12, NV21, YUY2 and UYVY images*/
 
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Split large fill, image and layer blending draw tasks into horizontal bands.
+     *  Idle draw units can steal the bands of the others, so a single large draw task
+     *  is rendered by all the draw units in parallel.
+     *  - > 0 requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`.
+     *  - Draw tasks covering at least this many pixels are split.
+     *  - 0: disable splitting */
+    #define LV_DRAW_SW_BAND_SPLIT_MIN_AREA  0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -196,6 +235,12 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /** Use SIMD accelerated blending.
+     *  - LV_DRAW_SW_ASM_NONE:     Use only the C implementation
+     *  - LV_DRAW_SW_ASM_NEON:     Arm Neon
+     *  - LV_DRAW_SW_ASM_HELIUM:   Arm Helium
+     *  - LV_DRAW_SW_ASM_X86_SIMD: SSE2/AVX2 on x86 and x86_64. The instruction set is selected with CPUID in run time.
+     *  - LV_DRAW_SW_ASM_CUSTOM:   Include `LV_DRAW_SW_ASM_CUSTOM_INCLUDE` */
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -431,6 +476,11 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Cache the resolved style properties of an object for this many part + state combinations
+ *  to get the style properties without checking all the styles of the object.
+ *  Uses about (50 + 9 x number of set properties) bytes per combination. 0: disable */
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -589,6 +639,17 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Number of recently used characters whose glyph index is cached for `lv_font_fmt_txt` fonts
+ *  (built-in, converted and BIN fonts). It speeds up fonts with a lot of characters, e.g. CJK fonts.
+ *  Each entry needs 16 bytes (24 bytes with 64 bit pointers). 0: disable the cache.
+ *  With an OS the cache needs the atomic builtins of GCC or Clang. */
+#define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 0
+
+/** Size of the cache of rendered glyphs of `lv_font_fmt_txt` fonts in bytes.
+ *  The glyphs are stored as A8 bitmaps and shared by all draw units. So 1 and 4 bpp glyphs are not
+ *  converted and compressed glyphs are not decompressed on every draw. 0: disable the cache. */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -739,6 +800,8 @@
 
 #define LV_USE_TILEVIEW   1
 
+#define LV_USE_VIRTUALLIST 1
+
 #define LV_USE_WIN        1
 
 /*==================
@@ -969,6 +1032,11 @@
     #if LV_USE_MEM_MONITOR
         #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
     #endif
+
+    /** Number of per-frame timing records to keep for each display. 0: disable.
+     *  Read them with `lv_sysmon_get_frame_stats()`.
+     *  - Requires `LV_USE_SYSMON = 1` */
+    #define LV_SYSMON_FRAME_STATS_CNT 0
 #endif /*LV_USE_SYSMON*/
 
 /** 1: Enable runtime performance profiler */
@@ -1122,6 +1190,9 @@
     #define LV_LINUX_FBDEV_RENDER_MODE   LV_DISPLAY_RENDER_MODE_PARTIAL
     #define LV_LINUX_FBDEV_BUFFER_COUNT  0
     #define LV_LINUX_FBDEV_BUFFER_SIZE   60
+    /** Render directly into the framebuffer using its two halves as buffers and pan between them.
+     *  Requires DIRECT or FULL render mode, the draw buffers above are not allocated then. */
+    #define LV_LINUX_FBDEV_USE_PANNING   0
 #endif
 
 /** Use Nuttx to open window and handle touchscreen */
@@ -1151,6 +1222,12 @@
 
 /** Driver for /dev/dri/card */
 #define LV_USE_LINUX_DRM        0
+#if LV_USE_LINUX_DRM
+    /** Number of DUMB buffers.
+     *  - 2: Rendering waits until the page flip of the previous frame is done.
+     *  - 3: Render the next frame into the third buffer while the page flip is pending. */
+    #define LV_LINUX_DRM_BUFFER_COUNT   2
+#endif
 
 /** Interface for TFT_eSPI */
 #define LV_USE_TFT_ESPI         0
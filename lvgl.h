@@ -82,6 +82,7 @@ extern "C" {
 #include "src/widgets/tabview/lv_tabview.h"
 #include "src/widgets/textarea/lv_textarea.h"
 #include "src/widgets/tileview/lv_tileview.h"
+#include "src/widgets/virtuallist/lv_virtuallist.h"
 #include "src/widgets/win/lv_win.h"
 
 #include "src/others/snapshot/lv_snapshot.h"
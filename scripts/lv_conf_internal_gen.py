@@ -49,6 +49,7 @@ fout.write(
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_X86_SIMD     3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -192,6 +193,7 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
 #if LV_USE_SYSMON == 0
     #define LV_USE_PERF_MONITOR 0
     #define LV_USE_MEM_MONITOR 0
+    #define LV_SYSMON_FRAME_STATS_CNT 0
 #endif /*LV_USE_SYSMON*/
 
 #ifndef LV_USE_LZ4
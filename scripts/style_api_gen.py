@@ -562,9 +562,9 @@ def style_const_set(p):
 
   cast = style_set_cast(p['style_type'])
   print("")
-  print("#define LV_STYLE_CONST_" + p['name'] + "(val) \\")
+  print("#define LV_STYLE_CONST_" + p['name'] + "(...) \\")
   print("    { \\")
-  print("        .prop = LV_STYLE_" + p['name'] + ", .value = { ." + p['style_type'] +" = " + cast + "val } \\")
+  print("        .prop = LV_STYLE_" + p['name'] + ", .value = { ." + p['style_type'] +" = " + cast + "__VA_ARGS__ } \\")
   print("    }")
 
 
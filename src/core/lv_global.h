@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -68,6 +68,10 @@ struct _snippet_stack;
 struct _lv_freetype_context_t;
 #endif
 
+#if LV_USE_OBSERVER
+struct _lv_subject_t;
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
 struct _lv_profiler_builtin_ctx_t;
 #endif
@@ -89,6 +93,9 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint32_t style_resolved_gen;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -120,6 +127,8 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_mutex_t img_decoder_open_mutex;      /**< Protect the cache lookups and `img_decoding_ll` */
+    lv_ll_t img_decoding_ll;                /**< The image sources being decoded to the cache right now */
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -189,10 +198,24 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    lv_font_fmt_txt_glyph_id_cache_entry_t font_fmt_txt_glyph_id_cache[LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE];
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_cache_t * font_fmt_txt_glyph_cache;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
 
+#if LV_USE_OBSERVER
+    struct _lv_subject_t * subject_pending_head;
+    struct _lv_subject_t * subject_pending_tail;
+    uint32_t subject_batch_depth;
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     struct _lv_profiler_builtin_ctx_t * profiler_context;
 #endif
@@ -550,6 +550,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_obj_style_resolved_cache_clear(obj);
+#endif
 }
 
 static void lv_obj_draw(lv_event_t * e)
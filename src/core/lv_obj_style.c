@@ -23,6 +23,9 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    #define style_resolved_gen LV_GLOBAL_DEFAULT()->style_resolved_gen
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -55,6 +58,15 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v);
+static void own_style_set_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    static lv_obj_style_resolved_t * resolved_get(lv_obj_t * obj, lv_style_selector_t selector);
+    static lv_obj_style_resolved_t * resolved_create(const lv_obj_t * obj, lv_style_selector_t selector);
+    static lv_style_res_t resolved_get_prop(const lv_obj_style_resolved_t * res, lv_style_prop_t prop,
+                                            lv_style_value_t * v);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -138,7 +150,7 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
 #if LV_OBJ_STYLE_CACHE
     uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
     if(lv_style_is_const(style)) {
-        lv_style_const_prop_t * props = style->values_and_props;
+        const lv_style_const_prop_t * props = lv_style_get_const_props(style);
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
             (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i].prop);
         }
@@ -276,6 +288,11 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The styles or their properties have changed, resolve them again*/
+    lv_obj_style_resolved_cache_clear(obj);
+#endif
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -367,7 +384,7 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
         lv_obj_invalidate(obj);
     }
 
-    lv_style_set_prop(style, prop, value);
+    own_style_set_prop(obj, style, prop, value);
 
 #if LV_OBJ_STYLE_CACHE
     uint32_t prop_shifted = STYLE_PROP_SHIFTED(prop);
@@ -625,6 +642,19 @@ void lv_obj_update_layer_type(lv_obj_t * obj)
     }
 }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+void lv_obj_style_resolved_cache_clear(lv_obj_t * obj)
+{
+    lv_obj_style_resolved_t * res = obj->style_resolved;
+    while(res) {
+        lv_obj_style_resolved_t * next = res->next;
+        lv_free(res);
+        res = next;
+    }
+    obj->style_resolved = NULL;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -755,6 +785,193 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Same as `get_prop_core` but use the resolved style properties of the object if enabled
+ */
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The transitions are skipped only temporarily, don't cache these values*/
+    if(!obj->skip_trans) {
+        lv_obj_style_resolved_t * res = resolved_get((lv_obj_t *)obj, selector);
+        if(res) return resolved_get_prop(res, prop, v);
+    }
+#endif
+
+    return get_prop_core(obj, selector, prop, v);
+}
+
+/**
+ * Set a property in a local or transition style of an object.
+ * These styles are used only by `obj` so the other objects' resolved styles remain valid.
+ * @param obj       pointer to an object
+ * @param style     pointer to a local or transition style of `obj`
+ * @param prop      the property to set
+ * @param value     the new value
+ */
+static void own_style_set_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint32_t gen = style_resolved_gen;
+    lv_style_set_prop(style, prop, value);
+    style_resolved_gen = gen;
+    lv_obj_style_resolved_cache_clear(obj);
+#else
+    LV_UNUSED(obj);
+    lv_style_set_prop(style, prop, value);
+#endif
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+
+/**
+ * Get the resolved style properties of an object for a part and state.
+ * Create them if they don't exist yet or they are outdated.
+ * @param obj       pointer to an object
+ * @param selector  OR-ed part and state
+ * @return          the resolved properties or NULL on out of memory
+ */
+static lv_obj_style_resolved_t * resolved_get(lv_obj_t * obj, lv_style_selector_t selector)
+{
+    lv_obj_style_resolved_t * prev = NULL;
+    lv_obj_style_resolved_t * res = obj->style_resolved;
+    uint32_t cnt = 0;
+    while(res) {
+        if(res->selector == selector) break;
+        cnt++;
+        /*Keep `prev` on the last but one table to easily remove the last*/
+        if(res->next) prev = res;
+        res = res->next;
+    }
+
+    if(res) {
+        if(res->gen == style_resolved_gen) {
+            /*Move to the head as it's the most recently used*/
+            if(res != obj->style_resolved) {
+                lv_obj_style_resolved_t * p = obj->style_resolved;
+                while(p->next != res) p = p->next;
+                p->next = res->next;
+                res->next = obj->style_resolved;
+                obj->style_resolved = res;
+            }
+            return res;
+        }
+
+        /*Outdated: all the tables were created before the styles changed*/
+        lv_obj_style_resolved_cache_clear(obj);
+        prev = NULL;
+        cnt = 0;
+    }
+    else if(cnt >= LV_OBJ_STYLE_RESOLVED_CACHE) {
+        /*Remove the least recently used table*/
+        if(prev) {
+            lv_free(prev->next);
+            prev->next = NULL;
+        }
+        else {
+            lv_free(obj->style_resolved);
+            obj->style_resolved = NULL;
+        }
+    }
+
+    res = resolved_create(obj, selector);
+    if(res == NULL) return NULL;
+
+    res->next = obj->style_resolved;
+    obj->style_resolved = res;
+    return res;
+}
+
+/**
+ * Collect the properties set by the styles of an object for a part and state and get their values.
+ * @param obj       pointer to an object
+ * @param selector  OR-ed part and state
+ * @return          the resolved properties or NULL on out of memory
+ */
+static lv_obj_style_resolved_t * resolved_create(const lv_obj_t * obj, lv_style_selector_t selector)
+{
+    const lv_part_t part = lv_obj_style_get_selector_part(selector);
+    const lv_state_t state_inv = ~lv_obj_style_get_selector_state(selector);
+
+    /*Mark the properties of the styles which can be used in this state*/
+    uint32_t prop_is_set[256 / 32];
+    lv_memzero(prop_is_set, sizeof(prop_is_set));
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        const lv_obj_style_t * obj_style = &obj->styles[i];
+        if(lv_obj_style_get_selector_part(obj_style->selector) != part) continue;
+        if(!obj_style->is_trans && (lv_obj_style_get_selector_state(obj_style->selector) & state_inv)) continue;
+
+        const lv_style_t * style = obj_style->style;
+        uint32_t j;
+        if(lv_style_is_const(style)) {
+            const lv_style_const_prop_t * props = lv_style_get_const_props(style);
+            for(j = 0; props[j].prop != LV_STYLE_PROP_INV; j++) {
+                prop_is_set[props[j].prop >> 5] |= (uint32_t)1 << (props[j].prop & 0x1F);
+            }
+        }
+        else {
+            const lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props +
+                                            style->prop_cnt * sizeof(lv_style_value_t);
+            for(j = 0; j < style->prop_cnt; j++) {
+                prop_is_set[props[j] >> 5] |= (uint32_t)1 << (props[j] & 0x1F);
+            }
+        }
+    }
+
+    uint32_t prop_cnt = 0;
+    uint32_t p;
+    for(p = 0; p < 256; p++) {
+        if(prop_is_set[p >> 5] & ((uint32_t)1 << (p & 0x1F))) prop_cnt++;
+    }
+
+    lv_obj_style_resolved_t * res = lv_malloc(sizeof(lv_obj_style_resolved_t) +
+                                              prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)));
+    if(res == NULL) return NULL;
+
+    res->next = NULL;
+    res->selector = selector;
+    res->gen = style_resolved_gen;
+    res->prop_cnt = prop_cnt;
+    lv_memcpy(res->prop_is_set, prop_is_set, sizeof(prop_is_set));
+
+    lv_style_value_t * values = (lv_style_value_t *)(res + 1);
+    lv_style_prop_t * props = (lv_style_prop_t *)(values + prop_cnt);
+    i = 0;
+    for(p = 0; p < 256; p++) {
+        if((prop_is_set[p >> 5] & ((uint32_t)1 << (p & 0x1F))) == 0) continue;
+        props[i] = (lv_style_prop_t)p;
+        get_prop_core(obj, selector, (lv_style_prop_t)p, &values[i]);
+        i++;
+    }
+
+    return res;
+}
+
+static lv_style_res_t resolved_get_prop(const lv_obj_style_resolved_t * res, lv_style_prop_t prop,
+                                        lv_style_value_t * v)
+{
+    if((res->prop_is_set[prop >> 5] & ((uint32_t)1 << (prop & 0x1F))) == 0) return LV_STYLE_RES_NOT_FOUND;
+
+    const lv_style_value_t * values = (const lv_style_value_t *)(res + 1);
+    const lv_style_prop_t * props = (const lv_style_prop_t *)(values + res->prop_cnt);
+
+    /*The properties are sorted, use binary search*/
+    uint32_t min = 0;
+    uint32_t max = res->prop_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(props[mid] < prop) min = mid + 1;
+        else max = mid;
+    }
+
+    *v = values[min];
+    return LV_STYLE_RES_FOUND;
+}
+
+#endif /*LV_OBJ_STYLE_RESOLVED_CACHE*/
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -895,7 +1112,7 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
-        lv_style_set_prop((lv_style_t *)obj->styles[i].style, tr->prop, value_final);
+        own_style_set_prop(obj, (lv_style_t *)obj->styles[i].style, tr->prop, value_final);
         if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
@@ -921,7 +1138,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
 
     lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     /*Be sure `trans_style` has a valid value*/
-    lv_style_set_prop((lv_style_t *)style_trans->style, tr->prop, tr->start_value);
+    own_style_set_prop(tr->obj, (lv_style_t *)style_trans->style, tr->prop, tr->start_value);
     lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
 
 }
@@ -991,7 +1208,7 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
             lv_style_t * style = (lv_style_t *)obj->styles[i].style;
             uint32_t j;
             if(lv_style_is_const(style)) {
-                lv_style_const_prop_t * props = style->values_and_props;
+                const lv_style_const_prop_t * props = lv_style_get_const_props(style);
                 for(j = 0; props[j].prop != LV_STYLE_PROP_INV; j++) {
                     obj->style_main_prop_is_set |= STYLE_PROP_SHIFTED(props[j].prop);
                 }
@@ -1011,7 +1228,7 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
             lv_style_t * style = (lv_style_t *)obj->styles[i].style;
             uint32_t j;
             if(lv_style_is_const(style)) {
-                lv_style_const_prop_t * props = style->values_and_props;
+                const lv_style_const_prop_t * props = lv_style_get_const_props(style);
                 for(j = 0; props[j].prop != LV_STYLE_PROP_INV; j++) {
                     obj->style_other_prop_is_set |= STYLE_PROP_SHIFTED(props[j].prop);
                 }
@@ -1043,7 +1260,7 @@ static void fade_in_anim_completed(lv_anim_t * a)
 static bool style_has_flag(const lv_style_t * style, uint32_t flag)
 {
     if(lv_style_is_const(style)) {
-        lv_style_const_prop_t * props = style->values_and_props;
+        const lv_style_const_prop_t * props = lv_style_get_const_props(style);
         uint32_t i;
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
             if(lv_style_prop_has_flag(props[i].prop, flag)) {
@@ -1075,7 +1292,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_cached(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1102,7 +1319,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_cached(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -31,6 +31,20 @@ struct _lv_obj_style_t {
     uint32_t is_trans : 1;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * The properties set by the styles of an object for a given part and state.
+ * Followed by `prop_cnt` values and `prop_cnt` properties in increasing order.
+ */
+struct _lv_obj_style_resolved_t {
+    lv_obj_style_resolved_t * next;     /**< The next less recently used table*/
+    lv_style_selector_t selector;       /**< The part and state*/
+    uint32_t gen;                       /**< The style generation when the table was created*/
+    uint32_t prop_is_set[256 / 32];     /**< One bit for each `lv_style_prop_t`*/
+    uint32_t prop_cnt;
+};
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -77,6 +91,15 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
  */
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * Free the resolved style properties of an object.
+ * They will be resolved again when a style property is read.
+ * @param obj   pointer to an object
+ */
+void lv_obj_style_resolved_cache_clear(lv_obj_t * obj);
+#endif
+
 /**
  * Update the layer type of a widget bayed on its current styles.
  * The result will be stored in `obj->spec_attr->layer_type`
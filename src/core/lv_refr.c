@@ -22,6 +22,7 @@
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
 #include "../font/lv_font_fmt_txt.h"
+#include "../others/observer/lv_observer.h"
 #include "../stdlib/lv_string.h"
 #include "lv_global.h"
 
@@ -39,7 +40,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void lv_refr_join_area(void);
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p);
+static bool inv_area_grow(lv_display_t * disp);
+static int64_t inv_area_get_merge_cost(lv_area_t * joined, const lv_area_t * a1, const lv_area_t * a2);
+static void update_inv_stats(lv_display_t * disp);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -276,6 +280,7 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->inv_add_cnt = 0;
         return;
     }
 
@@ -298,6 +303,11 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         com_area.x2 |= 0x7;    /*Round up: Nx8 - 1*/
     }
 
+    if(disp->inv_cap == 0 && inv_area_grow(disp) == false) {
+        LV_LOG_WARN("Couldn't allocate the invalidated areas");
+        return;
+    }
+
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
         disp->inv_areas[0] = scr_area;
@@ -309,20 +319,14 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return;
 
-    /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    /*Nothing to do if this area is in one of the saved areas*/
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
-    }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
+    disp->inv_add_cnt++;
+    inv_area_add(disp, &com_area);
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -376,28 +380,40 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+#if LV_USE_OBSERVER
+    /*Update the widgets with the deferred subject changes before drawing them*/
+    lv_subject_notify_deferred();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
+    LV_SYSMON_FRAME_STATS_BEGIN(disp_refr);
 
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
+    LV_SYSMON_FRAME_STATS_TICK(layout_tick);
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
 
     lv_obj_update_layout(disp_refr->bottom_layer);
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+    LV_SYSMON_FRAME_STATS_ADD(disp_refr, layout_us, layout_tick);
     LV_PROFILER_LAYOUT_END_TAG("layout");
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        disp_refr->inv_add_cnt = 0;
+        update_inv_stats(disp_refr);
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
 
-    lv_refr_join_area();
     refr_sync_areas();
+    LV_SYSMON_FRAME_STATS_TICK(render_tick);
     refr_invalid_areas();
+    LV_SYSMON_FRAME_STATS_ADD(disp_refr, render_us, render_tick);
+    update_inv_stats(disp_refr);
 
     if(disp_refr->inv_p == 0) goto refr_finish;
     /*In double buffered direct mode save the updated areas.
@@ -413,9 +429,8 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         }
     }
 
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
+    disp_refr->inv_add_cnt = 0;
 
 refr_finish:
 
@@ -423,6 +438,7 @@ refr_finish:
     lv_draw_sw_mask_cleanup();
 #endif
 
+    LV_SYSMON_FRAME_STATS_END(disp_refr);
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -434,42 +450,120 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Save an invalidated area. It's merged with the saved areas while refreshing them together is cheaper
+ * than refreshing them separately (see `LV_INV_AREA_MERGE_COST`).
+ * @param disp      pointer to a display
+ * @param area_p    the area to save
  */
-static void lv_refr_join_area(void)
+static void inv_area_add(lv_display_t * disp, const lv_area_t * area_p)
 {
-    LV_PROFILER_REFR_BEGIN;
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    lv_area_t area = *area_p;
+    lv_area_t joined;
+    uint32_t i = 0;
+    while(i < disp->inv_p) {
+        if(inv_area_get_merge_cost(&joined, &area, &disp->inv_areas[i]) < 0) {
+            /*Remove the merged area and check all the others again with the larger area*/
+            area = joined;
+            disp->inv_p--;
+            lv_memmove(&disp->inv_areas[i], &disp->inv_areas[i + 1], (disp->inv_p - i) * sizeof(lv_area_t));
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+    if(disp->inv_p >= disp->inv_cap && inv_area_grow(disp) == false) {
+        /*No more space: merge with the area which increases the refreshed area the least*/
+        uint32_t best_i = 0;
+        int64_t best_cost = INT64_MAX;
+        for(i = 0; i < disp->inv_p; i++) {
+            int64_t cost = inv_area_get_merge_cost(&joined, &area, &disp->inv_areas[i]);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_i = i;
             }
+        }
+
+        inv_area_get_merge_cost(&joined, &area, &disp->inv_areas[best_i]);
+        disp->inv_p--;
+        lv_memmove(&disp->inv_areas[best_i], &disp->inv_areas[best_i + 1], (disp->inv_p - best_i) * sizeof(lv_area_t));
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+        /*The joined area might cover other areas too*/
+        inv_area_add(disp, &joined);
+        return;
+    }
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    disp->inv_areas[disp->inv_p] = area;
+    disp->inv_area_joined[disp->inv_p] = 0;
+    disp->inv_p++;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
-            }
-        }
+/**
+ * Double the size of the invalidated area buffer up to `LV_INV_AREA_MAX_CNT`
+ * @param disp      pointer to a display
+ * @return          true: success; false: the limit is reached or out of memory
+ */
+static bool inv_area_grow(lv_display_t * disp)
+{
+    if(disp->inv_cap >= LV_INV_AREA_MAX_CNT) return false;
+
+    uint32_t new_cap = disp->inv_cap == 0 ? LV_INV_BUF_SIZE : disp->inv_cap * 2;
+    new_cap = LV_CLAMP(1, new_cap, LV_INV_AREA_MAX_CNT);
+
+    lv_area_t * areas = lv_realloc(disp->inv_areas, new_cap * sizeof(lv_area_t));
+    if(areas == NULL) return false;
+    disp->inv_areas = areas;
+
+    uint8_t * joined = lv_realloc(disp->inv_area_joined, new_cap * sizeof(uint8_t));
+    if(joined == NULL) return false;
+    lv_memzero(&joined[disp->inv_cap], (new_cap - disp->inv_cap) * sizeof(uint8_t));
+    disp->inv_area_joined = joined;
+
+    disp->inv_cap = new_cap;
+    return true;
+}
+
+/**
+ * Get the cost of merging two areas. The cost is the number of pixels refreshed in addition
+ * minus the cost of refreshing and flushing an area separately (`LV_INV_AREA_MERGE_COST`).
+ * @param joined    store the joined area here
+ * @param a1        pointer to an area
+ * @param a2        pointer to an other area
+ * @return          < 0: merging is worth it
+ */
+static int64_t inv_area_get_merge_cost(lv_area_t * joined, const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_join(joined, a1, a2);
+    return (int64_t)lv_area_get_size(joined) - lv_area_get_size(a1) - lv_area_get_size(a2) - LV_INV_AREA_MERGE_COST;
+}
+
+/**
+ * Update the invalidation statistics of a display after refreshing its invalidated areas
+ * @param disp      pointer to a display
+ */
+static void update_inv_stats(lv_display_t * disp)
+{
+    lv_display_inv_stats_t * stats = &disp->inv_stats;
+    stats->area_cnt = 0;
+    stats->px_cnt = 0;
+    stats->px_saved = 0;
+
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        stats->area_cnt++;
+        stats->px_cnt += lv_area_get_size(&disp->inv_areas[i]);
     }
-    LV_PROFILER_REFR_END;
+
+    /*A fixed size buffer would have refreshed the whole screen*/
+    if(disp->inv_add_cnt > LV_INV_BUF_SIZE) {
+        uint32_t scr_size = (uint32_t)lv_display_get_horizontal_resolution(disp) *
+                            lv_display_get_vertical_resolution(disp);
+        if(scr_size > stats->px_cnt) stats->px_saved = scr_size - stats->px_cnt;
+    }
+
+    stats->px_saved_total += stats->px_saved;
 }
 
 /**
@@ -730,7 +824,9 @@ static void refr_area(const lv_area_t * area_p)
         for(i = 0; i < tile_cnt; i++) {
             lv_layer_t * tile_layer = &tile_layers[i];
             while(tile_layer->draw_task_head) {
+                LV_SYSMON_FRAME_STATS_TICK(wait_tick);
                 lv_draw_dispatch_wait_for_request();
+                LV_SYSMON_FRAME_STATS_ADD(disp_refr, draw_wait_us, wait_tick);
                 lv_draw_dispatch();
             }
 
@@ -1238,7 +1334,9 @@ static void draw_buf_flush(lv_display_t * disp)
     lv_layer_t * layer = disp->layer_head;
 
     while(layer->draw_task_head) {
+        LV_SYSMON_FRAME_STATS_TICK(wait_tick);
         lv_draw_dispatch_wait_for_request();
+        LV_SYSMON_FRAME_STATS_ADD(disp, draw_wait_us, wait_tick);
         lv_draw_dispatch();
     }
 
@@ -1291,7 +1389,12 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(&offset_area));
 #endif
 
+    LV_SYSMON_FRAME_STATS_TICK(flush_tick);
     disp->flush_cb(disp, &offset_area, px_map);
+    LV_SYSMON_FRAME_STATS_ADD(disp, flush_cb_us, flush_tick);
+#if LV_SYSMON_FRAME_STATS_CNT
+    disp->frame_stats.act.flush_cnt++;
+#endif
     lv_display_send_event(disp, LV_EVENT_FLUSH_FINISH, &offset_area);
 
     LV_PROFILER_REFR_END;
@@ -1304,6 +1407,7 @@ static void wait_for_flushing(lv_display_t * disp)
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_START, NULL);
 
+    LV_SYSMON_FRAME_STATS_TICK(wait_tick);
     if(disp->flush_wait_cb) {
         if(disp->flushing) {
             disp->flush_wait_cb(disp);
@@ -1314,6 +1418,7 @@ static void wait_for_flushing(lv_display_t * disp)
         while(disp->flushing);
     }
     disp->flushing_last = 0;
+    LV_SYSMON_FRAME_STATS_ADD(disp, flush_wait_us, wait_tick);
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
 
@@ -205,6 +205,8 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     lv_ll_clear(&disp->sync_areas);
+    lv_free(disp->inv_areas);
+    lv_free(disp->inv_area_joined);
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -420,6 +422,18 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
     disp->buf_act = disp->buf_1;
 }
 
+void lv_display_set_next_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    LV_ASSERT_MSG(lv_display_is_double_buffered(disp), "The display needs to be double buffered");
+    LV_ASSERT_NULL(buf);
+
+    if(disp->buf_act == disp->buf_1) disp->buf_2 = buf;
+    else disp->buf_1 = buf;
+}
+
 void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size,
                             lv_display_render_mode_t render_mode)
 {
@@ -946,6 +960,19 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+void lv_display_get_inv_stats(lv_display_t * disp, lv_display_inv_stats_t * stats)
+{
+    lv_memzero(stats, sizeof(lv_display_inv_stats_t));
+
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        return;
+    }
+
+    *stats = disp->inv_stats;
+}
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
@@ -1091,8 +1118,6 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
     lv_obj_invalidate(disp->sys_layer);
 
@@ -78,6 +78,15 @@ typedef enum {
     LV_SCR_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/** Statistics about the invalidated areas of the last refresh*/
+typedef struct {
+    uint32_t area_cnt;          /**< Number of refreshed areas after merging*/
+    uint32_t px_cnt;            /**< Number of refreshed pixels*/
+    uint32_t px_saved;          /**< Pixels not refreshed compared to refreshing the whole screen when more than
+                                     `LV_INV_BUF_SIZE` areas were invalidated (as a fixed size area buffer would do)*/
+    uint64_t px_saved_total;    /**< Sum of `px_saved` since the display was created*/
+} lv_display_inv_stats_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
@@ -264,6 +273,15 @@ void lv_display_set_buffers_with_stride(lv_display_t * disp, void * buf1, void *
  */
 void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_draw_buf_t * buf2);
 
+/**
+ * Replace the draw buffer which is not active, i.e. which LVGL will render into after the
+ * active buffer is flushed. Drivers using more than two buffers (e.g. triple buffering)
+ * can call it from their `flush_cb` to rotate the buffers.
+ * @param disp              pointer to a display with two draw buffers
+ * @param buf               the new draw buffer, with the same size and color format as the others
+ */
+void lv_display_set_next_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf);
+
 /**
  * Set display render mode
  * @param disp              pointer to a display
@@ -542,6 +560,13 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+/**
+ * Get statistics about the invalidated areas of the last refresh.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param stats     store the statistics here
+ */
+void lv_display_get_inv_stats(lv_display_t * disp, lv_display_inv_stats_t * stats);
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -26,7 +26,7 @@ extern "C" {
  *      DEFINES
  *********************/
 #ifndef LV_INV_BUF_SIZE
-#define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
+#define LV_INV_BUF_SIZE 32 /**< Initial buffer size for invalid areas. It grows up to `LV_INV_AREA_MAX_CNT` */
 #endif
 
 /**********************
@@ -99,11 +99,14 @@ struct _lv_display_t {
 
     lv_color_format_t   color_format;
 
-    /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    /** Invalidated (marked to redraw) areas. They are merged when added so `inv_area_joined` is always 0*/
+    lv_area_t * inv_areas;
+    uint8_t * inv_area_joined;
     uint32_t inv_p;
+    uint32_t inv_cap;           /**< Number of areas `inv_areas` can store*/
+    uint32_t inv_add_cnt;       /**< Number of areas added since the last refresh (before merging)*/
     int32_t inv_en_cnt;
+    lv_display_inv_stats_t inv_stats;
 
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
@@ -166,6 +169,10 @@ struct _lv_display_t {
     lv_obj_t * mem_label;
 #endif
 
+#if LV_SYSMON_FRAME_STATS_CNT
+    lv_sysmon_frame_stats_ctx_t frame_stats;
+#endif
+
 };
 
 /**********************
@@ -24,6 +24,13 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Use larger tiles on large layers to limit the number of tiles*/
+#define TASK_INDEX_MAX_TILES    32
+
+/*The allocations are aligned to 8 bytes in the arena chunks*/
+#define ARENA_ALIGN             8
+#define ARENA_HEADER_SIZE       LV_ALIGN_UP(sizeof(lv_draw_arena_chunk_t), ARENA_ALIGN)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -33,6 +40,16 @@
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    static lv_draw_task_index_t * task_index_create(const lv_layer_t * layer);
+    static void task_index_delete(lv_layer_t * layer);
+    static bool task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t);
+    static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t);
+    static void task_index_update(lv_layer_t * layer, lv_draw_task_t * t);
+    static void task_index_get_tiles(const lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * tiles);
+    static bool task_index_is_independent(const lv_draw_task_index_t * index, const lv_draw_task_t * t_check);
+    static uint32_t task_index_get_dependent_count(const lv_draw_task_index_t * index, const lv_draw_task_t * t_check);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -56,6 +73,15 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    /*Allocate the first chunk in advance to not allocate anything while rendering*/
+    lv_draw_arena_chunk_t * chunk = lv_malloc(ARENA_HEADER_SIZE + LV_DRAW_TASK_ARENA_SIZE);
+    if(chunk) {
+        lv_memzero(chunk, sizeof(lv_draw_arena_chunk_t));
+        _draw_info.arena_head = chunk;
+    }
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -73,6 +99,18 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    lv_draw_arena_chunk_t * chunk = _draw_info.arena_head;
+    while(chunk) {
+        lv_draw_arena_chunk_t * next = chunk->next;
+        lv_free(chunk);
+        chunk = next;
+    }
+    lv_free(_draw_info.arena_spare);
+    _draw_info.arena_head = NULL;
+    _draw_info.arena_spare = NULL;
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -86,11 +124,76 @@ void * lv_draw_create_unit(size_t size)
     return new_unit;
 }
 
+void * lv_draw_arena_alloc(size_t size)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    size = LV_ALIGN_UP(size, ARENA_ALIGN);
+    if(size > LV_DRAW_TASK_ARENA_SIZE) return lv_malloc(size);
+
+    lv_draw_arena_chunk_t * chunk = _draw_info.arena_head;
+    if(chunk == NULL || chunk->used + size > LV_DRAW_TASK_ARENA_SIZE) {
+        /*The old chunks are kept until their draw tasks are finished*/
+        chunk = _draw_info.arena_spare;
+        _draw_info.arena_spare = NULL;
+        if(chunk == NULL) {
+            chunk = lv_malloc(ARENA_HEADER_SIZE + LV_DRAW_TASK_ARENA_SIZE);
+            if(chunk == NULL) return NULL;
+        }
+        chunk->used = 0;
+        chunk->live_cnt = 0;
+        chunk->next = _draw_info.arena_head;
+        _draw_info.arena_head = chunk;
+    }
+
+    void * p = (uint8_t *)chunk + ARENA_HEADER_SIZE + chunk->used;
+    chunk->used += size;
+    chunk->live_cnt++;
+    return p;
+#else
+    return lv_malloc(size);
+#endif
+}
+
+void lv_draw_arena_free(void * p)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    if(p == NULL) return;
+
+    lv_draw_arena_chunk_t * prev = NULL;
+    lv_draw_arena_chunk_t * chunk = _draw_info.arena_head;
+    while(chunk) {
+        uint8_t * data = (uint8_t *)chunk + ARENA_HEADER_SIZE;
+        if((uint8_t *)p >= data && (uint8_t *)p < data + LV_DRAW_TASK_ARENA_SIZE) {
+            chunk->live_cnt--;
+            if(chunk->live_cnt > 0) return;
+
+            /*Nothing is used from the chunk anymore: reset the current one in one step
+             *and remove the older ones*/
+            if(prev == NULL) {
+                chunk->used = 0;
+            }
+            else {
+                prev->next = chunk->next;
+                if(_draw_info.arena_spare == NULL) _draw_info.arena_spare = chunk;
+                else lv_free(chunk);
+            }
+            return;
+        }
+        prev = chunk;
+        chunk = chunk->next;
+    }
+#endif
+
+    /*Not allocated from the arena*/
+    lv_free(p);
+}
+
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = lv_draw_arena_alloc(sizeof(lv_draw_task_t));
     LV_ASSERT_MALLOC(new_task);
+    lv_memzero(new_task, sizeof(lv_draw_task_t));
     new_task->area = *coords;
     new_task->_real_area = *coords;
     new_task->clip_area = layer->_clip_area;
@@ -98,6 +201,21 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
     new_task->matrix = layer->matrix;
 #endif
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
+    LV_SYSMON_FRAME_STATS_ADD_TASK();
+
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    /*The index is needed only if the draw units can work in parallel.
+     *Create it only for an empty layer to be sure all the tasks are stored in it.*/
+    if(_draw_info.unit_cnt > 1 && layer->task_index == NULL && layer->draw_task_head == NULL) {
+        layer->task_index = task_index_create(layer);
+    }
+
+    if(layer->task_index) {
+        new_task->index_id = layer->task_index->next_id;
+        layer->task_index->next_id++;
+        if(!task_index_insert(layer->task_index, new_task)) task_index_delete(layer);
+    }
+#endif
 
     /*Find the tail*/
     if(layer->draw_task_head == NULL) {
@@ -120,6 +238,11 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    /*`_real_area` might be changed since the task was added*/
+    task_index_update(layer, t);
+#endif
+
     lv_draw_global_info_t * info = &_draw_info;
 
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
@@ -206,6 +329,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     while(t) {
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+            if(layer->task_index) task_index_remove(layer->task_index, t);
+#endif
             lv_cleanup_task(t, disp);
             if(t_prev != NULL)
                 t_prev->next = t_next;
@@ -218,6 +344,11 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    /*All tasks are finished, a new index will be created for the new tasks*/
+    if(layer->draw_task_head == NULL && layer->task_index) task_index_delete(layer);
+#endif
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -242,7 +373,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         /*Let all draw units to pick draw tasks*/
         lv_draw_unit_t * u = _draw_info.unit_head;
         while(u) {
+            LV_SYSMON_FRAME_STATS_TICK(dispatch_tick);
             int32_t taken_cnt = u->dispatch_cb(u, layer);
+            LV_SYSMON_FRAME_STATS_ADD_DISPATCH(disp, u, taken_cnt, dispatch_tick);
             if(taken_cnt != LV_DRAW_UNIT_IDLE) task_dispatched = true;
             u = u->next;
         }
@@ -345,6 +478,15 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     LV_PROFILER_DRAW_BEGIN;
     uint32_t cnt = 0;
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    lv_draw_dsc_base_t * base_dsc = t_check->draw_dsc;
+    if(base_dsc->layer && base_dsc->layer->task_index) {
+        cnt = task_index_get_dependent_count(base_dsc->layer->task_index, t_check);
+        LV_PROFILER_DRAW_END;
+        return cnt;
+    }
+#endif
+
     lv_draw_task_t * t = t_check->next;
     while(t) {
         if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
@@ -469,6 +611,15 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
     LV_PROFILER_DRAW_BEGIN;
+
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    if(layer->task_index) {
+        bool independent = task_index_is_independent(layer->task_index, t_check);
+        LV_PROFILER_DRAW_END;
+        return independent;
+    }
+#endif
+
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
@@ -521,6 +672,9 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
             }
 
             if(disp->layer_deinit) disp->layer_deinit(disp, layer_drawn);
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+            if(layer_drawn->task_index) task_index_delete(layer_drawn);
+#endif
             lv_free(layer_drawn);
         }
     }
@@ -530,7 +684,233 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t->draw_dsc);
-    lv_free(t);
+    lv_draw_arena_free(t->draw_dsc);
+    lv_draw_arena_free(t);
+
+}
+
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+
+/**
+ * Create a draw task index covering the buffer area of a layer
+ * @param layer     pointer to a layer
+ * @return          the created index or NULL on error
+ */
+static lv_draw_task_index_t * task_index_create(const lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(lv_draw_task_index_t));
+    LV_ASSERT_MALLOC(index);
+    if(index == NULL) return NULL;
+
+    int32_t w = LV_MAX(lv_area_get_width(&layer->buf_area), 1);
+    int32_t h = LV_MAX(lv_area_get_height(&layer->buf_area), 1);
+
+    index->area = layer->buf_area;
+    index->tile_w = LV_MAX(LV_DRAW_TASK_INDEX_TILE_SIZE, (w + TASK_INDEX_MAX_TILES - 1) / TASK_INDEX_MAX_TILES);
+    index->tile_h = LV_MAX(LV_DRAW_TASK_INDEX_TILE_SIZE, (h + TASK_INDEX_MAX_TILES - 1) / TASK_INDEX_MAX_TILES);
+    index->col_cnt = (w + index->tile_w - 1) / index->tile_w;
+    index->row_cnt = (h + index->tile_h - 1) / index->tile_h;
+
+    index->tiles = lv_malloc_zeroed(index->col_cnt * index->row_cnt * sizeof(lv_draw_task_index_tile_t));
+    LV_ASSERT_MALLOC(index->tiles);
+    if(index->tiles == NULL) {
+        lv_free(index);
+        return NULL;
+    }
+
+    return index;
+}
+
+/**
+ * Delete the draw task index of a layer.
+ * The tasks of the layer will be checked linearly until the layer becomes empty.
+ * @param layer     pointer to a layer
+ */
+static void task_index_delete(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->task_index;
+    int32_t tile_cnt = index->col_cnt * index->row_cnt;
+    int32_t i;
+    for(i = 0; i < tile_cnt; i++) {
+        lv_free(index->tiles[i].tasks);
+    }
 
+    lv_free(index->tiles);
+    lv_free(index);
+    layer->task_index = NULL;
 }
+
+/**
+ * Store a draw task in all the tiles touched by its `area` or `_real_area`
+ * @param index     pointer to a draw task index
+ * @param t         pointer to a draw task with `index_id` already set
+ * @return          false: out of memory
+ */
+static bool task_index_insert(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    lv_area_t a;
+    lv_area_join(&a, &t->area, &t->_real_area);
+    task_index_get_tiles(index, &a, &t->index_tiles);
+
+    int32_t x;
+    int32_t y;
+    for(y = t->index_tiles.y1; y <= t->index_tiles.y2; y++) {
+        for(x = t->index_tiles.x1; x <= t->index_tiles.x2; x++) {
+            lv_draw_task_index_tile_t * tile = &index->tiles[y * index->col_cnt + x];
+            if(tile->cnt == tile->capacity) {
+                uint32_t new_capacity = tile->capacity ? tile->capacity * 2 : 8;
+                lv_draw_task_t ** new_tasks = lv_realloc(tile->tasks, new_capacity * sizeof(lv_draw_task_t *));
+                if(new_tasks == NULL) return false;
+                tile->tasks = new_tasks;
+                tile->capacity = new_capacity;
+            }
+
+            /*Typically the newest task is inserted so look for its place from the end*/
+            uint32_t i = tile->cnt;
+            while(i > 0 && tile->tasks[i - 1]->index_id > t->index_id) {
+                tile->tasks[i] = tile->tasks[i - 1];
+                i--;
+            }
+            tile->tasks[i] = t;
+            tile->cnt++;
+        }
+    }
+
+    t->indexed = 1;
+    return true;
+}
+
+/**
+ * Remove a draw task from all the tiles where it's stored
+ * @param index     pointer to a draw task index
+ * @param t         pointer to a draw task
+ */
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    if(!t->indexed) return;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->index_tiles.y1; y <= t->index_tiles.y2; y++) {
+        for(x = t->index_tiles.x1; x <= t->index_tiles.x2; x++) {
+            lv_draw_task_index_tile_t * tile = &index->tiles[y * index->col_cnt + x];
+            /*Typically the oldest tasks are removed so look for it from the beginning*/
+            uint32_t i;
+            for(i = 0; i < tile->cnt; i++) {
+                if(tile->tasks[i] == t) {
+                    lv_memmove(&tile->tasks[i], &tile->tasks[i + 1], (tile->cnt - i - 1) * sizeof(lv_draw_task_t *));
+                    tile->cnt--;
+                    break;
+                }
+            }
+        }
+    }
+
+    t->indexed = 0;
+}
+
+/**
+ * Move a draw task to other tiles if its areas were changed after it was added
+ * @param layer     pointer to the layer of the draw task
+ * @param t         pointer to a draw task
+ */
+static void task_index_update(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    lv_draw_task_index_t * index = layer->task_index;
+    if(index == NULL || !t->indexed) return;
+
+    lv_area_t a;
+    lv_area_t tiles;
+    lv_area_join(&a, &t->area, &t->_real_area);
+    task_index_get_tiles(index, &a, &tiles);
+    if(lv_area_is_equal(&tiles, &t->index_tiles)) return;
+
+    task_index_remove(index, t);
+    if(!task_index_insert(index, t)) task_index_delete(layer);
+}
+
+/**
+ * Get the range of tiles touched by an area. Areas out of the index are mapped to the edge tiles.
+ * @param index     pointer to a draw task index
+ * @param area      the area to check
+ * @param tiles     store the first and last column and row here
+ */
+static void task_index_get_tiles(const lv_draw_task_index_t * index, const lv_area_t * area, lv_area_t * tiles)
+{
+    tiles->x1 = LV_CLAMP(0, (area->x1 - index->area.x1) / index->tile_w, index->col_cnt - 1);
+    tiles->x2 = LV_CLAMP(0, (area->x2 - index->area.x1) / index->tile_w, index->col_cnt - 1);
+    tiles->y1 = LV_CLAMP(0, (area->y1 - index->area.y1) / index->tile_h, index->row_cnt - 1);
+    tiles->y2 = LV_CLAMP(0, (area->y2 - index->area.y1) / index->tile_h, index->row_cnt - 1);
+}
+
+/**
+ * Same as `is_independent()` but check only the older tasks sharing a tile with `t_check`
+ * @param index     pointer to a draw task index
+ * @param t_check   check this task if it overlaps with the older ones
+ * @return          true: `t_check` is not overlapping with older tasks so it's independent
+ */
+static bool task_index_is_independent(const lv_draw_task_index_t * index, const lv_draw_task_t * t_check)
+{
+    lv_area_t tiles;
+    task_index_get_tiles(index, &t_check->_real_area, &tiles);
+
+    int32_t x;
+    int32_t y;
+    for(y = tiles.y1; y <= tiles.y2; y++) {
+        for(x = tiles.x1; x <= tiles.x2; x++) {
+            const lv_draw_task_index_tile_t * tile = &index->tiles[y * index->col_cnt + x];
+            uint32_t i;
+            for(i = 0; i < tile->cnt; i++) {
+                const lv_draw_task_t * t = tile->tasks[i];
+                /*The tasks are ordered so the rest is newer*/
+                if(t->index_id >= t_check->index_id) break;
+
+                if(t->state != LV_DRAW_TASK_STATE_READY && lv_area_is_on(&t->_real_area, &t_check->_real_area)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Same as `lv_draw_get_dependent_count()` but check only the newer tasks sharing a tile with `t_check`
+ * @param index     pointer to a draw task index
+ * @param t_check   count the tasks depending on this one
+ * @return          number of tasks depending on `t_check`
+ */
+static uint32_t task_index_get_dependent_count(const lv_draw_task_index_t * index, const lv_draw_task_t * t_check)
+{
+    lv_area_t tiles;
+    task_index_get_tiles(index, &t_check->area, &tiles);
+
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = tiles.y1; y <= tiles.y2; y++) {
+        for(x = tiles.x1; x <= tiles.x2; x++) {
+            const lv_draw_task_index_tile_t * tile = &index->tiles[y * index->col_cnt + x];
+            uint32_t i = tile->cnt;
+            while(i > 0) {
+                i--;
+                const lv_draw_task_t * t = tile->tasks[i];
+                /*The tasks are ordered so the rest is older*/
+                if(t->index_id <= t_check->index_id) break;
+
+                /*A task can be stored in multiple tiles, count it only in the first common one*/
+                if(x != LV_MAX(tiles.x1, t->index_tiles.x1) || y != LV_MAX(tiles.y1, t->index_tiles.y1)) continue;
+
+                if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
+                   lv_area_is_on(&t_check->area, &t->area)) {
+                    cnt++;
+                }
+            }
+        }
+    }
+
+    return cnt;
+}
+
+#endif /*LV_DRAW_TASK_INDEX_TILE_SIZE*/
@@ -100,6 +100,11 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    /** Spatial index of the unfinished draw tasks. Created only if there are multiple draw units.*/
+    lv_draw_task_index_t * task_index;
+#endif
+
     lv_layer_t * parent;
     lv_layer_t * next;
     bool all_tasks_added;
@@ -100,7 +100,7 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_DRAW_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
+    t->draw_dsc = lv_draw_arena_alloc(sizeof(*dsc));
     LV_ASSERT_MALLOC(t->draw_dsc);
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LABEL;
@@ -200,8 +200,13 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     uint32_t line_start     = 0;
     int32_t last_line_start = -1;
 
+    /*If the lines are known use them instead of breaking the text again*/
+    const uint32_t * line_starts = NULL;
+    uint32_t line_id = 0;
+    if(dsc->hint && dsc->hint->line_starts && line_height > 0) line_starts = dsc->hint->line_starts;
+
     /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    if(dsc->hint && line_starts == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -216,25 +221,39 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     }
 
     uint32_t remaining_len = dsc->text_length;
+    uint32_t line_end;
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space,
-                                                           w, NULL, dsc->flag);
+    if(line_starts) {
+        /*Jump to the first visible line*/
+        int32_t first_y = draw_unit->clip_area->y1 - line_height_font - pos.y;
+        if(first_y > 0) line_id = (first_y + line_height - 1) / line_height;
+        if(line_id >= dsc->hint->line_cnt) return;
 
-    /*Go the first visible line*/
-    while(pos.y + line_height_font < draw_unit->clip_area->y1) {
-        /*Go to next line*/
-        line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
-        pos.y += line_height;
+        line_start = line_starts[line_id];
+        line_end = line_starts[line_id + 1];
+        pos.y += (int32_t)line_id * line_height;
+    }
+    else {
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space,
+                                                      w, NULL, dsc->flag);
+
+        /*Go the first visible line*/
+        while(pos.y + line_height_font < draw_unit->clip_area->y1) {
+            /*Go to next line*/
+            line_start = line_end;
+            line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL,
+                                              dsc->flag);
+            pos.y += line_height;
+
+            /*Save at the threshold coordinate*/
+            if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
+                dsc->hint->line_start = line_start;
+                dsc->hint->y          = pos.y - coords->y1;
+                dsc->hint->coord_y    = coords->y1;
+            }
 
-        /*Save at the threshold coordinate*/
-        if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
-            dsc->hint->line_start = line_start;
-            dsc->hint->y          = pos.y - coords->y1;
-            dsc->hint->coord_y    = coords->y1;
+            if(dsc->text[line_start] == '\0') return;
         }
-
-        if(dsc->text[line_start] == '\0') return;
     }
 
     /*Align to middle*/
@@ -447,7 +466,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         remaining_len -= line_end - line_start;
         line_start = line_end;
         if(remaining_len) {
-            line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w, NULL, dsc->flag);
+            if(line_starts) {
+                line_id++;
+                if(line_id < dsc->hint->line_cnt) line_end = line_starts[line_id + 1];
+            }
+            else {
+                line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, dsc->letter_space, w,
+                                                  NULL, dsc->flag);
+            }
         }
 
         pos.x = coords->x1;
@@ -39,6 +39,13 @@ struct _lv_draw_label_hint_t {
     /** The 'y1' coordinate of the label when the hint was saved.
      * Used to invalidate the hint if the label has moved too much.*/
     int32_t coord_y;
+
+    /** Start index of every line and the length of the text (`line_cnt + 1` items), or NULL.
+     * If set, the first visible line is found directly and the lines are not broken again.*/
+    const uint32_t * line_starts;
+
+    /** Number of lines in `line_starts`*/
+    uint32_t line_cnt;
 };
 
 struct _lv_draw_glyph_dsc_t {
@@ -77,8 +77,46 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+    /** Creation order of the task in its layer. Used by the layer's `task_index`*/
+    uint32_t index_id;
+
+    /** The range of tiles of the layer's `task_index` in which the task is stored*/
+    lv_area_t index_tiles;
+
+    /** 1: the task is stored in the layer's `task_index`*/
+    uint8_t indexed : 1;
+#endif
 };
 
+#if LV_DRAW_TASK_INDEX_TILE_SIZE
+typedef struct {
+    /** The draw tasks touching the tile, ordered by `index_id`*/
+    lv_draw_task_t ** tasks;
+    uint32_t cnt;
+    uint32_t capacity;
+} lv_draw_task_index_tile_t;
+
+/**
+ * Bucket the unfinished draw tasks of a layer into tiles
+ * to quickly find the older draw tasks overlapping an area.
+ */
+struct _lv_draw_task_index_t {
+    /** The area covered by the tiles. Tasks outside of it are stored in the edge tiles.*/
+    lv_area_t area;
+    int32_t tile_w;
+    int32_t tile_h;
+    int32_t col_cnt;
+    int32_t row_cnt;
+
+    /** `index_id` of the next draw task added to the layer*/
+    uint32_t next_id;
+
+    /** `col_cnt * row_cnt` tiles*/
+    lv_draw_task_index_tile_t * tiles;
+};
+#endif
+
 struct _lv_draw_mask_t {
     void * user_data;
 };
@@ -173,8 +211,24 @@ struct _lv_draw_unit_t {
      * @return
      */
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
+
+#if LV_SYSMON_FRAME_STATS_CNT
+    /**
+     * Time spent with rendering the draw tasks in the draw unit's own thread [tick].
+     * Written only by the draw unit. The system monitor reads it when a frame starts and ends.
+     */
+    volatile uint32_t exec_ticks;
+#endif
 };
 
+#if LV_DRAW_TASK_ARENA_SIZE
+typedef struct _lv_draw_arena_chunk_t {
+    struct _lv_draw_arena_chunk_t * next;
+    uint32_t used;          /**< Number of bytes already taken from the chunk*/
+    uint32_t live_cnt;      /**< Number of allocations from the chunk which are not freed yet*/
+} lv_draw_arena_chunk_t;
+#endif
+
 typedef struct {
     lv_draw_unit_t * unit_head;
     uint32_t unit_cnt;
@@ -186,12 +240,33 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_TASK_ARENA_SIZE
+    lv_draw_arena_chunk_t * arena_head;     /**< The chunk to allocate from, followed by the older ones*/
+    lv_draw_arena_chunk_t * arena_spare;    /**< An emptied chunk kept to avoid reallocating it*/
+#endif
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Allocate memory for a draw task or draw descriptor.
+ * If `LV_DRAW_TASK_ARENA_SIZE > 0` it's taken from the draw task arena, else from the heap.
+ * Can be called only from the thread which creates the draw tasks.
+ * @param size      the size to allocate in bytes
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * lv_draw_arena_alloc(size_t size);
+
+/**
+ * Free memory allocated by `lv_draw_arena_alloc()`.
+ * Memory allocated with `lv_malloc()` can be freed too.
+ * When all the allocations of an arena chunk are freed the chunk is reset in one step.
+ * @param p         pointer to the memory to free
+ */
+void lv_draw_arena_free(void * p);
+
 /**********************
  *      MACROS
  **********************/
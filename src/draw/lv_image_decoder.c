@@ -20,11 +20,24 @@
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+#define img_decoder_open_mutex &(LV_GLOBAL_DEFAULT()->img_decoder_open_mutex)
+#define img_decoding_ll_p &(LV_GLOBAL_DEFAULT()->img_decoding_ll)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * An image source which is being decoded to the image cache by a thread.
+ * The other threads opening the same source wait for it instead of decoding it again.
+ */
+typedef struct {
+    const void * src;
+    lv_image_src_t src_type;
+    uint32_t waiter_cnt;        /**< Number of threads waiting for the decoding to finish*/
+    lv_thread_sync_t sync;      /**< Initialized by the first waiter*/
+} image_decoding_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -40,6 +53,10 @@ static uint32_t img_width_to_stride(lv_image_header_t * header);
 static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_open(lv_image_decoder_dsc_t * dsc, const lv_image_decoder_args_t * args);
+static image_decoding_t * decoding_find(const lv_image_decoder_dsc_t * dsc);
+static void decoding_wait(image_decoding_t * decoding);
+static void decoding_finish(image_decoding_t * decoding);
 
 /**********************
  *  STATIC VARIABLES
@@ -63,6 +80,9 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+
+    lv_mutex_init(img_decoder_open_mutex);
+    lv_ll_init(img_decoding_ll_p, sizeof(image_decoding_t));
 }
 
 /**
@@ -74,6 +94,8 @@ void lv_image_decoder_deinit(void)
     lv_cache_destroy(img_header_cache_p, NULL);
 
     lv_ll_clear(img_decoder_ll_p);
+
+    lv_mutex_delete(img_decoder_open_mutex);
 }
 
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header)
@@ -97,47 +119,46 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
-    if(lv_image_cache_is_enabled()) {
-        dsc->cache = img_cache_p;
-        /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
-            /*
-            * Check the cache first
-            * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
+    /*Without cache there is nothing to share between the threads, just decode the image*/
+    if(!lv_image_cache_is_enabled()) return decoder_open(dsc, args);
+
+    dsc->cache = img_cache_p;
+    /*Try cache first, unless we are told to ignore cache.*/
+    if(args && args->no_cache) return decoder_open(dsc, args);
+
+    /*
+     * Check the cache first
+     * If the image is found in the cache, just return it.
+     * If an other thread is decoding the same image, wait for it and check the cache again,
+     * so that the image is decoded and added to the cache only once.*/
+    lv_mutex_lock(img_decoder_open_mutex);
+    image_decoding_t * decoding;
+    while(1) {
+        if(try_cache(dsc) == LV_RESULT_OK) {
+            lv_mutex_unlock(img_decoder_open_mutex);
+            return LV_RESULT_OK;
         }
+
+        decoding = decoding_find(dsc);
+        if(decoding == NULL) break;
+        decoding_wait(decoding);
     }
 
-    /*Find the decoder that can open the image source, and get the header info in the same time.*/
-    dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
-    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
+    /*Mark the image as being decoded. Other images can be decoded in parallel.*/
+    decoding = lv_ll_ins_head(img_decoding_ll_p);
+    if(decoding) {
+        decoding->src = dsc->src;
+        decoding->src_type = dsc->src_type;
+        decoding->waiter_cnt = 0;
+    }
+    lv_mutex_unlock(img_decoder_open_mutex);
 
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-        .flush_cache = false,
-    };
+    lv_result_t res = decoder_open(dsc, args);
 
-    /*
-     * We assume that if a decoder can get the info, it can open the image.
-     * If decoder open failed, free the source and return error.
-     * If decoder open succeed, add the image to cache if enabled.
-     * */
-    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
-
-    /* Flush the D-Cache if enabled and the image was successfully opened */
-    if(dsc->args.flush_cache && res == LV_RESULT_OK && dsc->decoded != NULL) {
-        lv_draw_buf_flush_cache(dsc->decoded, NULL);
-        LV_LOG_INFO("Flushed D-cache: src %p (%s) (W%d x H%d, data: %p cf: %d)",
-                    src,
-                    dsc->src_type == LV_IMAGE_SRC_FILE ? (const char *)src : "c-array",
-                    dsc->decoded->header.w,
-                    dsc->decoded->header.h,
-                    (void *)dsc->decoded->data,
-                    dsc->decoded->header.cf);
+    if(decoding) {
+        lv_mutex_lock(img_decoder_open_mutex);
+        decoding_finish(decoding);
+        lv_mutex_unlock(img_decoder_open_mutex);
     }
 
     return res;
@@ -218,21 +239,20 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
 {
-    lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, search_key, NULL);
-    if(cache_entry == NULL) {
-        return NULL;
+    /*Other threads can find the entry as soon as it's added, so add it with all the data set*/
+    lv_image_cache_data_t data = *search_key;
+    data.decoded = decoded;
+    if(data.src_type == LV_IMAGE_SRC_FILE) {
+        data.src = lv_strdup(data.src);
     }
+    data.user_data = user_data; /*Need to free data on cache invalidate instead of decoder_close*/
+    data.decoder = decoder;
 
-    lv_image_cache_data_t * cached_data;
-    cached_data = lv_cache_entry_get_data(cache_entry);
-
-    /*Set the cache entry to decoder data*/
-    cached_data->decoded = decoded;
-    if(cached_data->src_type == LV_IMAGE_SRC_FILE) {
-        cached_data->src = lv_strdup(cached_data->src);
+    lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, &data, NULL);
+    if(cache_entry == NULL) {
+        if(data.src_type == LV_IMAGE_SRC_FILE) lv_free((void *)data.src);
+        return NULL;
     }
-    cached_data->user_data = user_data; /*Need to free data on cache invalidate instead of decoder_close*/
-    cached_data->decoder = decoder;
 
     return cache_entry;
 }
@@ -290,6 +310,96 @@ lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_d
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_result_t decoder_open(lv_image_decoder_dsc_t * dsc, const lv_image_decoder_args_t * args)
+{
+    /*Find the decoder that can open the image source, and get the header info in the same time.*/
+    dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
+    if(dsc->decoder == NULL) return LV_RESULT_INVALID;
+
+    /*Make a copy of args*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+        .flush_cache = false,
+    };
+
+    /*
+     * We assume that if a decoder can get the info, it can open the image.
+     * If decoder open failed, free the source and return error.
+     * If decoder open succeed, add the image to cache if enabled.
+     * */
+    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+
+    /* Flush the D-Cache if enabled and the image was successfully opened */
+    if(dsc->args.flush_cache && res == LV_RESULT_OK && dsc->decoded != NULL) {
+        lv_draw_buf_flush_cache(dsc->decoded, NULL);
+        LV_LOG_INFO("Flushed D-cache: src %p (%s) (W%d x H%d, data: %p cf: %d)",
+                    dsc->src,
+                    dsc->src_type == LV_IMAGE_SRC_FILE ? (const char *)dsc->src : "c-array",
+                    dsc->decoded->header.w,
+                    dsc->decoded->header.h,
+                    (void *)dsc->decoded->data,
+                    dsc->decoded->header.cf);
+    }
+
+    return res;
+}
+
+static image_decoding_t * decoding_find(const lv_image_decoder_dsc_t * dsc)
+{
+    image_decoding_t * decoding;
+    LV_LL_READ(img_decoding_ll_p, decoding) {
+        if(decoding->src_type != dsc->src_type) continue;
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+            if(lv_strcmp(decoding->src, dsc->src) == 0) return decoding;
+        }
+        else if(decoding->src == dsc->src) return decoding;
+    }
+
+    return NULL;
+}
+
+/**
+ * Wait until an other thread finishes decoding an image.
+ * `img_decoder_open_mutex` needs to be locked. It's released while waiting.
+ * @param decoding  the image being decoded
+ */
+static void decoding_wait(image_decoding_t * decoding)
+{
+    if(decoding->waiter_cnt == 0) lv_thread_sync_init(&decoding->sync);
+    decoding->waiter_cnt++;
+
+    lv_mutex_unlock(img_decoder_open_mutex);
+    lv_thread_sync_wait(&decoding->sync);
+    lv_mutex_lock(img_decoder_open_mutex);
+
+    /*The sync wakes up only one thread, so wake up the next waiter too. The last one frees the item.*/
+    decoding->waiter_cnt--;
+    if(decoding->waiter_cnt > 0) {
+        lv_thread_sync_signal(&decoding->sync);
+    }
+    else {
+        lv_thread_sync_delete(&decoding->sync);
+        lv_free(decoding);
+    }
+}
+
+/**
+ * Remove an image from the images being decoded and wake up the threads waiting for it.
+ * `img_decoder_open_mutex` needs to be locked.
+ * @param decoding  the image which was decoded
+ */
+static void decoding_finish(image_decoding_t * decoding)
+{
+    /*Not found anymore, so the next threads opening the image will check the cache again.*/
+    lv_ll_remove(img_decoding_ll_p, decoding);
+
+    if(decoding->waiter_cnt == 0) lv_free(decoding);
+    else lv_thread_sync_signal(&decoding->sync);
+}
+
 static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc, lv_image_header_t * header)
 {
     lv_memzero(header, sizeof(lv_image_header_t));
@@ -548,11 +548,12 @@ static void _draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     dsc->g = &g;
     _draw_nema_gfx_letter(draw_unit, dsc, NULL, NULL);
 
-    if(g.resolved_font && font->release_glyph) {
+    /*`entry` is set if the glyph is held in the glyph cache of an lv_font_fmt_txt font*/
+    if(g.resolved_font && (g.resolved_font->release_glyph || g.entry)) {
         lv_draw_nema_gfx_unit_t * draw_nema_gfx_unit = (lv_draw_nema_gfx_unit_t *)draw_unit;
         nema_cl_submit(&(draw_nema_gfx_unit->cl));
         nema_cl_wait(&(draw_nema_gfx_unit->cl));
-        font->release_glyph(font, &g);
+        lv_font_glyph_release_draw_data(&g);
     }
     LV_PROFILER_END;
 }
@@ -10,6 +10,7 @@
 #include "lv_draw_sw_blend_private.h"
 #include "../../lv_draw_private.h"
 #include "../lv_draw_sw.h"
+#include "../../../stdlib/lv_string.h"
 #if LV_DRAW_SW_SUPPORT_L8
     #include "lv_draw_sw_blend_to_l8.h"
 #endif
@@ -41,6 +42,13 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+
+static void image_blend(lv_color_format_t dest_cf, lv_draw_sw_blend_image_dsc_t * image_dsc);
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+    static bool yuv_has_direct_blend(lv_color_format_t dest_cf, const lv_draw_sw_blend_image_dsc_t * image_dsc);
+    static void yuv_blend_in_chunks(lv_layer_t * layer, const lv_draw_sw_blend_image_dsc_t * image_dsc);
+#endif
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -152,9 +160,12 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.src_color_format = blend_dsc->src_color_format;
 
         const uint8_t * src_buf = blend_dsc->src_buf;
-        uint32_t src_px_size = lv_color_format_get_bpp(blend_dsc->src_color_format);
-        src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
-        src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
+        /*The planes of the YUV images are found from the image's origin using `src_area`*/
+        if(!LV_COLOR_FORMAT_IS_YUV(blend_dsc->src_color_format)) {
+            uint32_t src_px_size = lv_color_format_get_bpp(blend_dsc->src_color_format);
+            src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
+            src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
+        }
         image_dsc.src_buf = src_buf;
         image_dsc.mask_stride = 0;
 
@@ -179,52 +190,224 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
                                                     blend_area.y1 - layer->buf_area.y1);
 
-        switch(layer->color_format) {
-#if LV_DRAW_SW_SUPPORT_RGB565
-            case LV_COLOR_FORMAT_RGB565:
-            case LV_COLOR_FORMAT_RGB565A8:
-                lv_draw_sw_blend_image_to_rgb565(&image_dsc);
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+        if(LV_COLOR_FORMAT_IS_YUV(image_dsc.src_color_format) &&
+           !yuv_has_direct_blend(layer->color_format, &image_dsc)) {
+            yuv_blend_in_chunks(layer, &image_dsc);
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+#endif
+
+        image_blend(layer->color_format, &image_dsc);
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+void lv_draw_sw_yuv_planes_init(lv_draw_sw_yuv_planes_t * planes, const void * src, int32_t src_stride,
+                                lv_color_format_t cf)
+{
+    const lv_yuv_buf_t * yuv = src;
+    lv_memzero(planes, sizeof(lv_draw_sw_yuv_planes_t));
+    planes->y_step = 1;
+    planes->c_step = 1;
+
+    switch(cf) {
+        case LV_COLOR_FORMAT_I420:
+        case LV_COLOR_FORMAT_I422:
+        case LV_COLOR_FORMAT_I444:
+            planes->y = yuv->planar.y.buf;
+            planes->u = yuv->planar.u.buf;
+            planes->v = yuv->planar.v.buf;
+            planes->y_stride = yuv->planar.y.stride;
+            planes->u_stride = yuv->planar.u.stride;
+            planes->v_stride = yuv->planar.v.stride;
+            planes->c_shift_x = cf == LV_COLOR_FORMAT_I444 ? 0 : 1;
+            planes->c_shift_y = cf == LV_COLOR_FORMAT_I420 ? 1 : 0;
+            break;
+        case LV_COLOR_FORMAT_I400:
+            planes->y = yuv->planar.y.buf;
+            planes->y_stride = yuv->planar.y.stride;
+            break;
+        case LV_COLOR_FORMAT_NV12:
+        case LV_COLOR_FORMAT_NV21:
+            planes->y = yuv->semi_planar.y.buf;
+            planes->y_stride = yuv->semi_planar.y.stride;
+            planes->u = (const uint8_t *)yuv->semi_planar.uv.buf + (cf == LV_COLOR_FORMAT_NV21 ? 1 : 0);
+            planes->v = (const uint8_t *)yuv->semi_planar.uv.buf + (cf == LV_COLOR_FORMAT_NV21 ? 0 : 1);
+            planes->u_stride = yuv->semi_planar.uv.stride;
+            planes->v_stride = yuv->semi_planar.uv.stride;
+            planes->c_step = 2;
+            planes->c_shift_x = 1;
+            planes->c_shift_y = 1;
+            break;
+        case LV_COLOR_FORMAT_YUY2:
+        case LV_COLOR_FORMAT_UYVY: {
+                const uint8_t * src_u8 = src;
+                bool yuy2 = cf == LV_COLOR_FORMAT_YUY2;
+                planes->y = src_u8 + (yuy2 ? 0 : 1);
+                planes->u = src_u8 + (yuy2 ? 1 : 0);
+                planes->v = src_u8 + (yuy2 ? 3 : 2);
+                planes->y_stride = src_stride;
+                planes->u_stride = src_stride;
+                planes->v_stride = src_stride;
+                planes->y_step = 2;
+                planes->c_step = 4;
+                planes->c_shift_x = 1;
                 break;
+            }
+        default:
+            break;
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_yuv_to_argb8888_row(const lv_draw_sw_yuv_planes_t * planes, int32_t x,
+                                                          int32_t y, int32_t w, lv_color32_t * dest)
+{
+    const uint8_t * y_row = planes->y + y * planes->y_stride;
+    const uint8_t * u_row = planes->u ? planes->u + (y >> planes->c_shift_y) * planes->u_stride : NULL;
+    const uint8_t * v_row = planes->v ? planes->v + (y >> planes->c_shift_y) * planes->v_stride : NULL;
+
+    int32_t cx_last = -1;
+    int32_t r_ofs = 128, g_ofs = 128, b_ofs = 128;
+    int32_t i;
+    for(i = 0; i < w; i++) {
+        int32_t src_x = x + i;
+        int32_t cx = src_x >> planes->c_shift_x;
+        if(u_row && cx != cx_last) {
+            int32_t d = u_row[cx * planes->c_step] - 128;
+            int32_t e = v_row[cx * planes->c_step] - 128;
+            r_ofs = 409 * e + 128;
+            g_ofs = -100 * d - 208 * e + 128;
+            b_ofs = 516 * d + 128;
+            cx_last = cx;
+        }
+
+        int32_t c = (y_row[src_x * planes->y_step] - 16) * 298;
+        dest[i].red = LV_CLAMP(0, (c + r_ofs) >> 8, 255);
+        dest[i].green = LV_CLAMP(0, (c + g_ofs) >> 8, 255);
+        dest[i].blue = LV_CLAMP(0, (c + b_ofs) >> 8, 255);
+        dest[i].alpha = 0xff;
+    }
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void image_blend(lv_color_format_t dest_cf, lv_draw_sw_blend_image_dsc_t * image_dsc)
+{
+    switch(dest_cf) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+            lv_draw_sw_blend_image_to_rgb565(image_dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
-            case LV_COLOR_FORMAT_ARGB8888:
-                lv_draw_sw_blend_image_to_argb8888(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_image_to_argb8888(image_dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
-            case LV_COLOR_FORMAT_RGB888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 3);
-                break;
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_image_to_rgb888(image_dsc, 3);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_XRGB8888
-            case LV_COLOR_FORMAT_XRGB8888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 4);
-                break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_image_to_rgb888(image_dsc, 4);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_L8
-            case LV_COLOR_FORMAT_L8:
-                lv_draw_sw_blend_image_to_l8(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_image_to_l8(image_dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_AL88
-            case LV_COLOR_FORMAT_AL88:
-                lv_draw_sw_blend_image_to_al88(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_image_to_al88(image_dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_I1
-            case LV_COLOR_FORMAT_I1:
-                lv_draw_sw_blend_image_to_i1(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_I1:
+            lv_draw_sw_blend_image_to_i1(image_dsc);
+            break;
 #endif
-            default:
-                break;
+        default:
+            break;
+    }
+}
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+/**
+ * The opaque YUV images are converted directly into the common color formats
+ */
+static bool yuv_has_direct_blend(lv_color_format_t dest_cf, const lv_draw_sw_blend_image_dsc_t * image_dsc)
+{
+    if(image_dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+    if(image_dsc->mask_buf || image_dsc->opa < LV_OPA_MAX) return false;
+
+    switch(dest_cf) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+#endif
+        case LV_COLOR_FORMAT_ARGB8888:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Convert the pixels in small chunks to ARGB8888 and blend them with the ARGB8888 image blending.
+ * Used with opacity, masks, non normal blend modes and the less common destination color formats.
+ */
+static void yuv_blend_in_chunks(lv_layer_t * layer, const lv_draw_sw_blend_image_dsc_t * image_dsc)
+{
+    lv_color32_t chunk_buf[LV_DRAW_SW_YUV_CHUNK_W];
+    lv_draw_sw_yuv_planes_t planes;
+    lv_draw_sw_yuv_planes_init(&planes, image_dsc->src_buf, image_dsc->src_stride, image_dsc->src_color_format);
+
+    int32_t src_x = image_dsc->relative_area.x1 - image_dsc->src_area.x1;
+    int32_t src_y = image_dsc->relative_area.y1 - image_dsc->src_area.y1;
+
+    lv_draw_sw_blend_image_dsc_t chunk_dsc = *image_dsc;
+    chunk_dsc.src_buf = chunk_buf;
+    chunk_dsc.src_stride = sizeof(chunk_buf);
+    chunk_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    chunk_dsc.dest_h = 1;
+
+    int32_t y;
+    int32_t x;
+    for(y = 0; y < image_dsc->dest_h; y++) {
+        for(x = 0; x < image_dsc->dest_w; x += LV_DRAW_SW_YUV_CHUNK_W) {
+            chunk_dsc.dest_w = LV_MIN(LV_DRAW_SW_YUV_CHUNK_W, image_dsc->dest_w - x);
+            lv_draw_sw_yuv_to_argb8888_row(&planes, src_x + x, src_y + y, chunk_dsc.dest_w, chunk_buf);
+
+            lv_area_set(&chunk_dsc.relative_area, image_dsc->relative_area.x1 + x, image_dsc->relative_area.y1 + y,
+                        image_dsc->relative_area.x1 + x + chunk_dsc.dest_w - 1, image_dsc->relative_area.y1 + y);
+            chunk_dsc.src_area = chunk_dsc.relative_area;
+            chunk_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, chunk_dsc.relative_area.x1, chunk_dsc.relative_area.y1);
+            if(image_dsc->mask_buf) chunk_dsc.mask_buf = image_dsc->mask_buf + y * image_dsc->mask_stride + x;
+
+            image_blend(layer->color_format, &chunk_dsc);
         }
     }
-    LV_PROFILER_DRAW_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
 
 #endif
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_sw_blend.h"
+#include "../../../misc/lv_math.h"
 
 #if LV_USE_DRAW_SW
 
@@ -22,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of YUV pixels converted at once to a buffer on the stack*/
+#define LV_DRAW_SW_YUV_CHUNK_W      64
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -74,11 +78,76 @@ struct _lv_draw_sw_blend_image_dsc_t {
     lv_area_t src_area;             /**< The original src area. */
 };
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+/**
+ * Uniform description of the planar, semi-planar and packed YUV formats.
+ * The Y of pixel (x, y) is at `y + y * y_stride + x * y_step`, its chroma is at
+ * `u/v + (y >> c_shift_y) * u/v_stride + (x >> c_shift_x) * c_step`.
+ */
+typedef struct {
+    const uint8_t * y;
+    const uint8_t * u;          /**< NULL if there is no chroma channel*/
+    const uint8_t * v;
+    int32_t y_stride;
+    int32_t u_stride;
+    int32_t v_stride;
+    uint8_t y_step;
+    uint8_t c_step;
+    uint8_t c_shift_x;
+    uint8_t c_shift_y;
+} lv_draw_sw_yuv_planes_t;
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+/**
+ * Describe the planes of a YUV image. The planar formats store an `lv_yuv_buf_t` in the image data,
+ * the packed ones store the pixels directly.
+ * @param planes        store the description here
+ * @param src           the data of the image
+ * @param src_stride    the stride of the packed formats
+ * @param cf            the YUV color format of the image
+ */
+void lv_draw_sw_yuv_planes_init(lv_draw_sw_yuv_planes_t * planes, const void * src, int32_t src_stride,
+                                lv_color_format_t cf);
+
+/**
+ * Convert a part of a row of a YUV image to ARGB8888 with the BT.601 limited range coefficients.
+ * The chroma dependent terms are calculated only once for the pixels sharing them.
+ * @param planes    the description of the image
+ * @param x         the first pixel to convert
+ * @param y         the row to convert
+ * @param w         the number of pixels to convert
+ * @param dest      store the pixels here
+ */
+void lv_draw_sw_yuv_to_argb8888_row(const lv_draw_sw_yuv_planes_t * planes, int32_t x, int32_t y, int32_t w,
+                                    lv_color32_t * dest);
+
+/**
+ * Convert a YUV pixel to RGB with the BT.601 limited range coefficients
+ * @param y     the luma
+ * @param u     the blue difference chroma
+ * @param v     the red difference chroma
+ * @return      the opaque RGB color
+ */
+static inline lv_color32_t lv_draw_sw_yuv_to_color32(int32_t y, int32_t u, int32_t v)
+{
+    int32_t c = (y - 16) * 298 + 128;
+    int32_t d = u - 128;
+    int32_t e = v - 128;
+
+    lv_color32_t px;
+    px.red = LV_CLAMP(0, (c + 409 * e) >> 8, 255);
+    px.green = LV_CLAMP(0, (c - 100 * d - 208 * e) >> 8, 255);
+    px.blue = LV_CLAMP(0, (c + 516 * d) >> 8, 255);
+    px.alpha = 0xff;
+    return px;
+}
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -22,6 +22,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -71,6 +73,10 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
+#if LV_DRAW_SW_SUPPORT_YUV
+    static void /* LV_ATTRIBUTE_FAST_MEM */ yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_32_mix(const uint8_t src, lv_color32_t * dest, uint8_t mix);
 
 static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg,
@@ -186,6 +192,10 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(...)  LV_RESULT_INVALID
 #endif
 
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_ARGB8888
+    #define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_ARGB8888(...)                    LV_RESULT_INVALID
+#endif
+
 #ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_ARGB8888
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_ARGB8888(...)  LV_RESULT_INVALID
 #endif
@@ -350,6 +360,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_argb8888(lv_draw_sw_blend_i
         case LV_COLOR_FORMAT_I1:
             i1_image_blend(dsc);
             break;
+#endif
+#if LV_DRAW_SW_SUPPORT_YUV
+        case LV_COLOR_FORMAT_I420:
+        case LV_COLOR_FORMAT_I422:
+        case LV_COLOR_FORMAT_I444:
+        case LV_COLOR_FORMAT_I400:
+        case LV_COLOR_FORMAT_NV12:
+        case LV_COLOR_FORMAT_NV21:
+        case LV_COLOR_FORMAT_YUY2:
+        case LV_COLOR_FORMAT_UYVY:
+            yuv_image_blend(dsc);
+            break;
 #endif
         default:
             LV_LOG_WARN("Not supported source color format");
@@ -949,6 +971,28 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     }
 }
 
+#if LV_DRAW_SW_SUPPORT_YUV
+
+/*Only the opaque images are blended with the normal mode here, the other cases are blended from ARGB8888 chunks*/
+static void LV_ATTRIBUTE_FAST_MEM yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID == LV_DRAW_SW_YUV_BLEND_NORMAL_TO_ARGB8888(dsc)) {
+        lv_draw_sw_yuv_planes_t planes;
+        lv_draw_sw_yuv_planes_init(&planes, dsc->src_buf, dsc->src_stride, dsc->src_color_format);
+        int32_t src_x = dsc->relative_area.x1 - dsc->src_area.x1;
+        int32_t src_y = dsc->relative_area.y1 - dsc->src_area.y1;
+
+        lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+        int32_t y;
+        for(y = 0; y < dsc->dest_h; y++) {
+            lv_draw_sw_yuv_to_argb8888_row(&planes, src_x, src_y + y, dsc->dest_w, dest_buf_c32);
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dsc->dest_stride);
+        }
+    }
+}
+
+#endif
+
 static inline void LV_ATTRIBUTE_FAST_MEM lv_color_8_32_mix(const uint8_t src, lv_color32_t * dest, uint8_t mix)
 {
 
@@ -22,6 +22,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -63,6 +65,10 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
     static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 #endif
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+    static void /* LV_ATTRIBUTE_FAST_MEM */ yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ l8_to_rgb565(const uint8_t c1);
 
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_16_mix(const uint8_t c1, uint16_t c2, uint8_t mix);
@@ -175,6 +181,10 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(...)    LV_RESULT_INVALID
 #endif
 
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB565
+    #define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB565(...)                      LV_RESULT_INVALID
+#endif
+
 #ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565(...)  LV_RESULT_INVALID
 #endif
@@ -394,6 +404,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565(lv_draw_sw_blend_ima
         case LV_COLOR_FORMAT_I1:
             i1_image_blend(dsc);
             break;
+#endif
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_I420:
+        case LV_COLOR_FORMAT_I422:
+        case LV_COLOR_FORMAT_I444:
+        case LV_COLOR_FORMAT_I400:
+        case LV_COLOR_FORMAT_NV12:
+        case LV_COLOR_FORMAT_NV21:
+        case LV_COLOR_FORMAT_YUY2:
+        case LV_COLOR_FORMAT_UYVY:
+            yuv_image_blend(dsc);
+            break;
 #endif
         default:
             LV_LOG_WARN("Not supported source color format");
@@ -1091,6 +1113,40 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
 
 #endif
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+/*Only the opaque images are blended with the normal mode here, the other cases are blended from ARGB8888 chunks*/
+static void LV_ATTRIBUTE_FAST_MEM yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(LV_RESULT_INVALID == LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB565(dsc)) {
+        lv_draw_sw_yuv_planes_t planes;
+        lv_draw_sw_yuv_planes_init(&planes, dsc->src_buf, dsc->src_stride, dsc->src_color_format);
+        int32_t src_x = dsc->relative_area.x1 - dsc->src_area.x1;
+        int32_t src_y = dsc->relative_area.y1 - dsc->src_area.y1;
+
+        lv_color32_t chunk_buf[LV_DRAW_SW_YUV_CHUNK_W];
+        uint16_t * dest_buf_u16 = dsc->dest_buf;
+        int32_t y;
+        for(y = 0; y < dsc->dest_h; y++) {
+            int32_t x;
+            for(x = 0; x < dsc->dest_w; x += LV_DRAW_SW_YUV_CHUNK_W) {
+                int32_t chunk_w = LV_MIN(LV_DRAW_SW_YUV_CHUNK_W, dsc->dest_w - x);
+                lv_draw_sw_yuv_to_argb8888_row(&planes, src_x + x, src_y + y, chunk_w, chunk_buf);
+
+                int32_t i;
+                for(i = 0; i < chunk_w; i++) {
+                    dest_buf_u16[x + i] = ((chunk_buf[i].red & 0xF8) << 8) +
+                                          ((chunk_buf[i].green & 0xFC) << 3) +
+                                          ((chunk_buf[i].blue & 0xF8) >> 3);
+                }
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        }
+    }
+}
+
+#endif
+
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM l8_to_rgb565(const uint8_t c1)
 {
     return ((c1 & 0xF8) << 8) + ((c1 & 0xFC) << 3) + ((c1 & 0xF8) >> 3);
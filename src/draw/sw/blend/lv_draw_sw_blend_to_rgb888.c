@@ -22,6 +22,8 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+    #include "x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -56,6 +58,10 @@
     static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size);
 #endif
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+    static void /* LV_ATTRIBUTE_FAST_MEM */ yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size);
+#endif
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
                                                            const uint8_t dest_px_size,
                                                            uint32_t src_px_size);
@@ -161,6 +167,10 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(...)    LV_RESULT_INVALID
 #endif
 
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB888
+    #define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB888(...)                      LV_RESULT_INVALID
+#endif
+
 #ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_888
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_888(...)  LV_RESULT_INVALID
 #endif
@@ -344,6 +354,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb888(lv_draw_sw_blend_ima
         case LV_COLOR_FORMAT_I1:
             i1_image_blend(dsc, dest_px_size);
             break;
+#endif
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_I420:
+        case LV_COLOR_FORMAT_I422:
+        case LV_COLOR_FORMAT_I444:
+        case LV_COLOR_FORMAT_I400:
+        case LV_COLOR_FORMAT_NV12:
+        case LV_COLOR_FORMAT_NV21:
+        case LV_COLOR_FORMAT_YUY2:
+        case LV_COLOR_FORMAT_UYVY:
+            yuv_image_blend(dsc, dest_px_size);
+            break;
 #endif
         default:
             LV_LOG_WARN("Not supported source color format");
@@ -903,6 +925,48 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
 
 #endif
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+/*Only the opaque images are blended with the normal mode here, the other cases are blended from ARGB8888 chunks*/
+static void LV_ATTRIBUTE_FAST_MEM yuv_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    if(LV_RESULT_INVALID == LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size)) {
+        lv_draw_sw_yuv_planes_t planes;
+        lv_draw_sw_yuv_planes_init(&planes, dsc->src_buf, dsc->src_stride, dsc->src_color_format);
+        int32_t src_x = dsc->relative_area.x1 - dsc->src_area.x1;
+        int32_t src_y = dsc->relative_area.y1 - dsc->src_area.y1;
+
+        uint8_t * dest_buf = dsc->dest_buf;
+        int32_t y;
+        for(y = 0; y < dsc->dest_h; y++) {
+            /*XRGB8888 has the same layout, so it's converted in place*/
+            if(dest_px_size == 4) {
+                lv_draw_sw_yuv_to_argb8888_row(&planes, src_x, src_y + y, dsc->dest_w, (lv_color32_t *)dest_buf);
+            }
+            else {
+                lv_color32_t chunk_buf[LV_DRAW_SW_YUV_CHUNK_W];
+                int32_t x;
+                for(x = 0; x < dsc->dest_w; x += LV_DRAW_SW_YUV_CHUNK_W) {
+                    int32_t chunk_w = LV_MIN(LV_DRAW_SW_YUV_CHUNK_W, dsc->dest_w - x);
+                    lv_draw_sw_yuv_to_argb8888_row(&planes, src_x + x, src_y + y, chunk_w, chunk_buf);
+
+                    uint8_t * dest_px = &dest_buf[x * 3];
+                    int32_t i;
+                    for(i = 0; i < chunk_w; i++) {
+                        dest_px[0] = chunk_buf[i].blue;
+                        dest_px[1] = chunk_buf[i].green;
+                        dest_px[2] = chunk_buf[i].red;
+                        dest_px += 3;
+                    }
+                }
+            }
+            dest_buf += dsc->dest_stride;
+        }
+    }
+}
+
+#endif
+
 static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest, lv_color32_t src, lv_blend_mode_t mode)
 {
     uint8_t res[3] = {0, 0, 0};
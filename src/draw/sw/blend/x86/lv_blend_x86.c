@@ -0,0 +1,1058 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_x86.h"
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD && defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../../../../misc/lv_math.h"
+
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Allow using the intrinsics without enabling them globally with compiler flags*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define SSE2_FUNC   __attribute__((target("sse2")))
+    #define AVX2_FUNC   __attribute__((target("avx2")))
+#else
+    #define SSE2_FUNC
+    #define AVX2_FUNC
+#endif
+
+#define RGB_BITS        0x00FFFFFF
+#define ALPHA_BITS      0xFF000000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*How to get the mix ratio of a pixel*/
+typedef enum {
+    ALPHA_OPA,              /*opa*/
+    ALPHA_MASK,             /*mask[x]*/
+    ALPHA_MASK_OPA,         /*LV_OPA_MIX2(mask[x], opa)*/
+    ALPHA_SRC,              /*src[x].alpha*/
+    ALPHA_SRC_OPA,          /*LV_OPA_MIX2(src[x].alpha, opa)*/
+    ALPHA_SRC_MASK,         /*LV_OPA_MIX2(src[x].alpha, mask[x])*/
+    ALPHA_SRC_MASK_OPA,     /*LV_OPA_MIX3(src[x].alpha, mask[x], opa)*/
+} alpha_mode_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_draw_sw_x86_simd_t detect_simd_level(void);
+
+static alpha_mode_t get_alpha_mode(bool src_has_alpha, const lv_opa_t * mask, lv_opa_t opa);
+
+static void fill_u16_sse2(uint16_t * dest, uint16_t color, int32_t w);
+static void fill_u32_sse2(uint32_t * dest, uint32_t color, int32_t w);
+static void rgb565_mix_row_sse2(uint16_t * dest, const uint16_t * src, uint16_t color, const lv_opa_t * mask,
+                                lv_opa_t opa, alpha_mode_t mode, int32_t w);
+static void argb8888_to_rgb565_row_sse2(uint16_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                        lv_opa_t opa, alpha_mode_t mode, int32_t w);
+static void xrgb8888_mix_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const lv_opa_t * mask,
+                                  lv_opa_t opa, alpha_mode_t mode, int32_t w);
+static void argb8888_mix_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const lv_opa_t * mask,
+                                  lv_opa_t opa, alpha_mode_t mode, int32_t w);
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+static void yuv_to_argb8888_row_sse2(const lv_draw_sw_yuv_planes_t * planes, int32_t x, int32_t y, int32_t w,
+                                     uint32_t * dest);
+#endif
+
+static void fill_u16_avx2(uint16_t * dest, uint16_t color, int32_t w);
+static void fill_u32_avx2(uint32_t * dest, uint32_t color, int32_t w);
+static void rgb565_mix_row_avx2(uint16_t * dest, const uint16_t * src, uint16_t color, const lv_opa_t * mask,
+                                lv_opa_t opa, alpha_mode_t mode, int32_t w);
+static void argb8888_mix_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color, const lv_opa_t * mask,
+                                  lv_opa_t opa, alpha_mode_t mode, int32_t w);
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Set only on the main thread and read by the render threads*/
+static lv_draw_sw_x86_simd_t simd_level;
+static lv_draw_sw_x86_simd_t simd_level_max;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_x86_simd_init(void)
+{
+    simd_level_max = detect_simd_level();
+    simd_level = simd_level_max;
+}
+
+lv_draw_sw_x86_simd_t lv_draw_sw_x86_simd_get_level(void)
+{
+    return simd_level;
+}
+
+void lv_draw_sw_x86_simd_set_level(lv_draw_sw_x86_simd_t level)
+{
+    simd_level = LV_MIN(level, simd_level_max);
+}
+
+lv_result_t lv_color_blend_to_rgb565_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) fill_u16_avx2(dest_buf_u16, color16, dsc->dest_w);
+        else fill_u16_sse2(dest_buf_u16, color16, dsc->dest_w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(false, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) {
+            rgb565_mix_row_avx2(dest_buf_u16, NULL, color16, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        else {
+            rgb565_mix_row_sse2(dest_buf_u16, NULL, color16, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(false, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) {
+            rgb565_mix_row_avx2(dest_buf_u16, src_buf_u16, 0, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        else {
+            rgb565_mix_row_sse2(dest_buf_u16, src_buf_u16, 0, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(true, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        argb8888_to_rgb565_row_sse2(dest_buf_u16, src_buf_u32, mask, dsc->opa, mode, dsc->dest_w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_x86(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    /*RGB888 is filled by copying the first line which is fast enough already*/
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    return lv_color_blend_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_color_blend_to_rgb888_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+    if(lv_draw_sw_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(false, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        xrgb8888_mix_row_sse2(dest_buf_u32, NULL, color32, mask, dsc->opa, mode, dsc->dest_w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb888_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size,
+                                                 uint32_t src_px_size)
+{
+    if(dst_px_size != 4 || src_px_size != 4) return LV_RESULT_INVALID;
+    if(lv_draw_sw_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(false, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        xrgb8888_mix_row_sse2(dest_buf_u32, src_buf_u32, 0, mask, dsc->opa, mode, dsc->dest_w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+    if(lv_draw_sw_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(true, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        xrgb8888_mix_row_sse2(dest_buf_u32, src_buf_u32, 0, mask, dsc->opa, mode, dsc->dest_w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) fill_u32_avx2(dest_buf_u32, color32, dsc->dest_w);
+        else fill_u32_sse2(dest_buf_u32, color32, dsc->dest_w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(false, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) {
+            argb8888_mix_row_avx2(dest_buf_u32, NULL, color32, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        else {
+            argb8888_mix_row_sse2(dest_buf_u32, NULL, color32, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_draw_sw_x86_simd_t level = lv_draw_sw_x86_simd_get_level();
+    if(level == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    alpha_mode_t mode = get_alpha_mode(true, mask, dsc->opa);
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        if(level == LV_DRAW_SW_X86_SIMD_AVX2) {
+            argb8888_mix_row_avx2(dest_buf_u32, src_buf_u32, 0, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        else {
+            argb8888_mix_row_sse2(dest_buf_u32, src_buf_u32, 0, mask, dsc->opa, mode, dsc->dest_w);
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+lv_result_t lv_yuv_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(lv_draw_sw_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    lv_draw_sw_yuv_planes_t planes;
+    lv_draw_sw_yuv_planes_init(&planes, dsc->src_buf, dsc->src_stride, dsc->src_color_format);
+    int32_t src_x = dsc->relative_area.x1 - dsc->src_area.x1;
+    int32_t src_y = dsc->relative_area.y1 - dsc->src_area.y1;
+    alpha_mode_t mode = get_alpha_mode(true, NULL, LV_OPA_COVER);
+
+    uint32_t chunk_buf[LV_DRAW_SW_YUV_CHUNK_W];
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        int32_t x;
+        for(x = 0; x < dsc->dest_w; x += LV_DRAW_SW_YUV_CHUNK_W) {
+            int32_t chunk_w = LV_MIN(LV_DRAW_SW_YUV_CHUNK_W, dsc->dest_w - x);
+            yuv_to_argb8888_row_sse2(&planes, src_x + x, src_y + y, chunk_w, chunk_buf);
+            argb8888_to_rgb565_row_sse2(&dest_buf_u16[x], chunk_buf, NULL, LV_OPA_COVER, mode, chunk_w);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_yuv_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    /*XRGB8888 has the same layout*/
+    return lv_yuv_blend_normal_to_argb8888_x86(dsc);
+}
+
+lv_result_t lv_yuv_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    if(lv_draw_sw_x86_simd_get_level() == LV_DRAW_SW_X86_SIMD_NONE) return LV_RESULT_INVALID;
+
+    lv_draw_sw_yuv_planes_t planes;
+    lv_draw_sw_yuv_planes_init(&planes, dsc->src_buf, dsc->src_stride, dsc->src_color_format);
+    int32_t src_x = dsc->relative_area.x1 - dsc->src_area.x1;
+    int32_t src_y = dsc->relative_area.y1 - dsc->src_area.y1;
+
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        yuv_to_argb8888_row_sse2(&planes, src_x, src_y + y, dsc->dest_w, dest_buf_u32);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_draw_sw_x86_simd_t detect_simd_level(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return LV_DRAW_SW_X86_SIMD_AVX2;
+    if(__builtin_cpu_supports("sse2")) return LV_DRAW_SW_X86_SIMD_SSE2;
+    return LV_DRAW_SW_X86_SIMD_NONE;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    /*AVX2 also needs the OS to save the YMM registers (OSXSAVE and XCR0)*/
+    bool avx_os = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+    if(avx_os && max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        if(info[1] & (1 << 5)) return LV_DRAW_SW_X86_SIMD_AVX2;
+    }
+
+    return sse2 ? LV_DRAW_SW_X86_SIMD_SSE2 : LV_DRAW_SW_X86_SIMD_NONE;
+#else
+    return LV_DRAW_SW_X86_SIMD_NONE;
+#endif
+}
+
+static alpha_mode_t get_alpha_mode(bool src_has_alpha, const lv_opa_t * mask, lv_opa_t opa)
+{
+    if(src_has_alpha) {
+        if(mask == NULL) return opa >= LV_OPA_MAX ? ALPHA_SRC : ALPHA_SRC_OPA;
+        else return opa >= LV_OPA_MAX ? ALPHA_SRC_MASK : ALPHA_SRC_MASK_OPA;
+    }
+    else {
+        if(mask == NULL) return ALPHA_OPA;
+        else return opa >= LV_OPA_MAX ? ALPHA_MASK : ALPHA_MASK_OPA;
+    }
+}
+
+static inline lv_opa_t get_alpha(alpha_mode_t mode, lv_opa_t src_alpha, lv_opa_t mask, lv_opa_t opa)
+{
+    switch(mode) {
+        case ALPHA_OPA:
+            return opa;
+        case ALPHA_MASK:
+            return mask;
+        case ALPHA_MASK_OPA:
+            return LV_OPA_MIX2(mask, opa);
+        case ALPHA_SRC:
+            return src_alpha;
+        case ALPHA_SRC_OPA:
+            return LV_OPA_MIX2(src_alpha, opa);
+        case ALPHA_SRC_MASK:
+            return LV_OPA_MIX2(src_alpha, mask);
+        default:
+            return LV_OPA_MIX3(src_alpha, mask, opa);
+    }
+}
+
+/*The scalar versions of the mixing functions below must give the same result as the ones in
+ *lv_draw_sw_blend_to_*.c. They are used for the last few pixels of the lines.*/
+
+static inline uint16_t mix_24_16(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+static inline void mix_24_24(const uint8_t * src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        dest[0] = (uint32_t)((uint32_t)src[0] * mix + dest[0] * mix_inv) >> 8;
+        dest[1] = (uint32_t)((uint32_t)src[1] * mix + dest[1] * mix_inv) >> 8;
+        dest[2] = (uint32_t)((uint32_t)src[2] * mix + dest[2] * mix_inv) >> 8;
+    }
+}
+
+static inline lv_color32_t mix_32_32(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+/*--------------------
+ * SSE2
+ *--------------------*/
+
+static inline __m128i SSE2_FUNC select_sse2(__m128i sel, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+
+/*Load 4 mask values to 32 bit lanes without reading beyond the mask*/
+static inline __m128i SSE2_FUNC load_mask_x4_sse2(const lv_opa_t * mask)
+{
+    return _mm_setr_epi32(mask[0], mask[1], mask[2], mask[3]);
+}
+
+/*Get the mix ratio of 4 pixels in 32 bit lanes. `opa_v` has `opa` in each 32 bit lane.*/
+static inline __m128i SSE2_FUNC alpha_x4_sse2(alpha_mode_t mode, __m128i src, const lv_opa_t * mask, __m128i opa_v)
+{
+    /*The values are < 256 so the 16 bit multiplications are exact and the upper halves stay 0*/
+    switch(mode) {
+        case ALPHA_OPA:
+            return opa_v;
+        case ALPHA_MASK:
+            return load_mask_x4_sse2(mask);
+        case ALPHA_MASK_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi16(load_mask_x4_sse2(mask), opa_v), 8);
+        case ALPHA_SRC:
+            return _mm_srli_epi32(src, 24);
+        case ALPHA_SRC_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(src, 24), opa_v), 8);
+        case ALPHA_SRC_MASK:
+            return _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(src, 24), load_mask_x4_sse2(mask)), 8);
+        default:
+            return _mm_mulhi_epu16(_mm_mullo_epi16(_mm_srli_epi32(src, 24), load_mask_x4_sse2(mask)), opa_v);
+    }
+}
+
+/*Get the mix ratio of 8 pixels in 16 bit lanes. `opa_v` has `opa` in each 16 bit lane.*/
+static inline __m128i SSE2_FUNC alpha_x8_sse2(alpha_mode_t mode, __m128i src_alpha, const lv_opa_t * mask,
+                                              __m128i opa_v)
+{
+    __m128i mask_v = _mm_setzero_si128();
+    if(mode == ALPHA_MASK || mode == ALPHA_MASK_OPA || mode == ALPHA_SRC_MASK || mode == ALPHA_SRC_MASK_OPA) {
+        mask_v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)mask), _mm_setzero_si128());
+    }
+
+    switch(mode) {
+        case ALPHA_OPA:
+            return opa_v;
+        case ALPHA_MASK:
+            return mask_v;
+        case ALPHA_MASK_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(mask_v, opa_v), 8);
+        case ALPHA_SRC:
+            return src_alpha;
+        case ALPHA_SRC_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(src_alpha, opa_v), 8);
+        case ALPHA_SRC_MASK:
+            return _mm_srli_epi16(_mm_mullo_epi16(src_alpha, mask_v), 8);
+        default:
+            return _mm_mulhi_epu16(_mm_mullo_epi16(src_alpha, mask_v), opa_v);
+    }
+}
+
+static void SSE2_FUNC fill_u16_sse2(uint16_t * dest, uint16_t color, int32_t w)
+{
+    __m128i color_v = _mm_set1_epi16((short)color);
+    int32_t x = 0;
+    for(; x <= w - 8; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static void SSE2_FUNC fill_u32_sse2(uint32_t * dest, uint32_t color, int32_t w)
+{
+    __m128i color_v = _mm_set1_epi32((int)color);
+    int32_t x = 0;
+    for(; x <= w - 4; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+/**
+ * `lv_color_16_16_mix()` on 4 pixels. `fg`, `bg` and `mix` have the same 16 bit value in both halves
+ * of the 32 bit lanes. `mix` is already scaled to 0..32.
+ */
+static inline __m128i SSE2_FUNC rgb565_mix_x4_sse2(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i ch_mask = _mm_set1_epi32(0x07E0F81F);
+    fg = _mm_and_si128(fg, ch_mask);
+    bg = _mm_and_si128(bg, ch_mask);
+
+    /*(fg - bg) * mix on 32 bit. mix < 2^16 so it's lo(diff) * mix + (hi(diff) * mix << 16)*/
+    __m128i diff = _mm_sub_epi32(fg, bg);
+    __m128i prod = _mm_add_epi32(_mm_mullo_epi16(diff, mix), _mm_slli_epi32(_mm_mulhi_epu16(diff, mix), 16));
+    __m128i res = _mm_and_si128(_mm_add_epi32(_mm_srli_epi32(prod, 5), bg), ch_mask);
+    res = _mm_or_si128(res, _mm_srli_epi32(res, 16));
+
+    /*Sign extend the lower 16 bits to make packing with signed saturation lossless*/
+    return _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+}
+
+/*`lv_color_16_16_mix()` on 8 pixels*/
+static inline __m128i SSE2_FUNC rgb565_mix_sse2(__m128i fg, __m128i bg, __m128i mix)
+{
+    __m128i mix5 = _mm_srli_epi16(_mm_add_epi16(mix, _mm_set1_epi16(4)), 3);
+    __m128i res_lo = rgb565_mix_x4_sse2(_mm_unpacklo_epi16(fg, fg), _mm_unpacklo_epi16(bg, bg),
+                                        _mm_unpacklo_epi16(mix5, mix5));
+    __m128i res_hi = rgb565_mix_x4_sse2(_mm_unpackhi_epi16(fg, fg), _mm_unpackhi_epi16(bg, bg),
+                                        _mm_unpackhi_epi16(mix5, mix5));
+    __m128i res = _mm_packs_epi32(res_lo, res_hi);
+
+    /*Fully opaque pixels are copied as the 5 bit ratio would loose a bit*/
+    return select_sse2(_mm_cmpeq_epi16(mix, _mm_set1_epi16(255)), fg, res);
+}
+
+static void SSE2_FUNC rgb565_mix_row_sse2(uint16_t * dest, const uint16_t * src, uint16_t color, const lv_opa_t * mask,
+                                          lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    __m128i color_v = _mm_set1_epi16((short)color);
+    __m128i opa_v = _mm_set1_epi16(opa);
+    int32_t x = 0;
+    for(; x <= w - 8; x += 8) {
+        __m128i fg = src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i mix = alpha_x8_sse2(mode, _mm_setzero_si128(), mask ? &mask[x] : NULL, opa_v);
+        _mm_storeu_si128((__m128i *)&dest[x], rgb565_mix_sse2(fg, bg, mix));
+    }
+
+    for(; x < w; x++) {
+        uint16_t fg = src ? src[x] : color;
+        dest[x] = lv_color_16_16_mix(fg, dest[x], get_alpha(mode, 0, mask ? mask[x] : 0, opa));
+    }
+}
+
+static void SSE2_FUNC argb8888_to_rgb565_row_sse2(uint16_t * dest, const uint32_t * src, const lv_opa_t * mask,
+                                                  lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i ff = _mm_set1_epi16(255);
+    __m128i opa_v = _mm_set1_epi16(opa);
+    int32_t x = 0;
+    for(; x <= w - 8; x += 8) {
+        __m128i s0 = _mm_loadu_si128((const __m128i *)&src[x]);
+        __m128i s1 = _mm_loadu_si128((const __m128i *)&src[x + 4]);
+
+        /*Separate the channels to 16 bit lanes*/
+        __m128i b = _mm_packs_epi32(_mm_and_si128(s0, byte_mask), _mm_and_si128(s1, byte_mask));
+        __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 8), byte_mask),
+                                    _mm_and_si128(_mm_srli_epi32(s1, 8), byte_mask));
+        __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 16), byte_mask),
+                                    _mm_and_si128(_mm_srli_epi32(s1, 16), byte_mask));
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(s0, 24), _mm_srli_epi32(s1, 24));
+
+        __m128i mix = alpha_x8_sse2(mode, a, mask ? &mask[x] : NULL, opa_v);
+        __m128i mix_inv = _mm_sub_epi16(ff, mix);
+
+        __m128i d = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i d_r = _mm_srli_epi16(d, 11);
+        __m128i d_g = _mm_and_si128(_mm_srli_epi16(d, 5), _mm_set1_epi16(0x3F));
+        __m128i d_b = _mm_and_si128(d, _mm_set1_epi16(0x1F));
+
+        __m128i r5 = _mm_srli_epi16(r, 3);
+        __m128i g6 = _mm_srli_epi16(g, 2);
+        __m128i b5 = _mm_srli_epi16(b, 3);
+
+        __m128i res_r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(r5, mix), _mm_mullo_epi16(d_r, mix_inv)), 8);
+        __m128i res_g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(g6, mix), _mm_mullo_epi16(d_g, mix_inv)), 8);
+        __m128i res_b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(b5, mix), _mm_mullo_epi16(d_b, mix_inv)), 8);
+        __m128i res = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(res_r, 11), _mm_slli_epi16(res_g, 5)), res_b);
+
+        __m128i opaque = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r5, 11), _mm_slli_epi16(g6, 5)), b5);
+        res = select_sse2(_mm_cmpeq_epi16(mix, ff), opaque, res);
+        res = select_sse2(_mm_cmpeq_epi16(mix, _mm_setzero_si128()), d, res);
+
+        _mm_storeu_si128((__m128i *)&dest[x], res);
+    }
+
+    for(; x < w; x++) {
+        const uint8_t * src_u8 = (const uint8_t *)&src[x];
+        dest[x] = mix_24_16(src_u8, dest[x], get_alpha(mode, src_u8[3], mask ? mask[x] : 0, opa));
+    }
+}
+
+/*(fg * a + bg * (255 - a)) >> 8 on all the 4 channels of 4 pixels. `a` is in 32 bit lanes.*/
+static inline __m128i SSE2_FUNC mix_u8_sse2(__m128i fg, __m128i bg, __m128i a)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ff = _mm_set1_epi16(255);
+
+    /*Spread the ratio of the pixels to the 16 bit lanes of their channels*/
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    __m128i a_lo = _mm_unpacklo_epi32(a, a);
+    __m128i a_hi = _mm_unpackhi_epi32(a, a);
+
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), a_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(ff, a_lo)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), a_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(ff, a_hi)));
+
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+static void SSE2_FUNC xrgb8888_mix_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                            const lv_opa_t * mask, lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    const __m128i rgb_mask = _mm_set1_epi32(RGB_BITS);
+    __m128i color_v = _mm_set1_epi32((int)color);
+    __m128i opa_v = _mm_set1_epi32(opa);
+    int32_t x = 0;
+    for(; x <= w - 4; x += 4) {
+        __m128i fg = src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i a = alpha_x4_sse2(mode, fg, mask ? &mask[x] : NULL, opa_v);
+
+        __m128i res = mix_u8_sse2(fg, bg, a);
+        res = select_sse2(_mm_cmpgt_epi32(a, _mm_set1_epi32(LV_OPA_MAX - 1)), fg, res);
+        res = select_sse2(_mm_cmpeq_epi32(a, _mm_setzero_si128()), bg, res);
+
+        /*The 4th byte of the destination is kept*/
+        _mm_storeu_si128((__m128i *)&dest[x], select_sse2(rgb_mask, res, bg));
+    }
+
+    for(; x < w; x++) {
+        const uint8_t * fg = src ? (const uint8_t *)&src[x] : (const uint8_t *)&color;
+        mix_24_24(fg, (uint8_t *)&dest[x], get_alpha(mode, fg[3], mask ? mask[x] : 0, opa));
+    }
+}
+
+static void SSE2_FUNC argb8888_mix_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                            const lv_opa_t * mask, lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    const __m128i rgb_mask = _mm_set1_epi32(RGB_BITS);
+    const __m128i alpha_mask = _mm_set1_epi32((int)ALPHA_BITS);
+    const __m128i opa_min = _mm_set1_epi32(LV_OPA_MIN + 1);
+    const __m128i opa_max = _mm_set1_epi32(LV_OPA_MAX - 1);
+    __m128i color_v = _mm_set1_epi32((int)color);
+    __m128i opa_v = _mm_set1_epi32(opa);
+    int32_t x = 0;
+    for(; x <= w - 4; x += 4) {
+        __m128i fg = src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i a = alpha_x4_sse2(mode, fg, mask ? &mask[x] : NULL, opa_v);
+        fg = _mm_or_si128(_mm_and_si128(fg, rgb_mask), _mm_slli_epi32(a, 24));
+
+        /*The cases of `lv_color_32_32_mix()`*/
+        __m128i bg_a = _mm_srli_epi32(bg, 24);
+        __m128i use_fg = _mm_or_si128(_mm_cmpgt_epi32(a, opa_max), _mm_cmplt_epi32(bg_a, opa_min));
+        __m128i use_bg = _mm_andnot_si128(use_fg, _mm_cmplt_epi32(a, opa_min));
+        __m128i use_mix = _mm_andnot_si128(_mm_or_si128(use_fg, use_bg), _mm_cmpeq_epi32(bg_a, _mm_set1_epi32(255)));
+
+        if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(use_fg, use_bg), use_mix)) != 0xFFFF) {
+            /*Both colors are semi-transparent. It's rare, so mix these pixels one by one*/
+            lv_color32_t fg_px[4];
+            _mm_storeu_si128((__m128i *)fg_px, fg);
+            lv_color32_t * dest_c32 = (lv_color32_t *)&dest[x];
+            dest_c32[0] = mix_32_32(fg_px[0], dest_c32[0]);
+            dest_c32[1] = mix_32_32(fg_px[1], dest_c32[1]);
+            dest_c32[2] = mix_32_32(fg_px[2], dest_c32[2]);
+            dest_c32[3] = mix_32_32(fg_px[3], dest_c32[3]);
+            continue;
+        }
+
+        __m128i res = _mm_or_si128(mix_u8_sse2(fg, bg, a), alpha_mask);
+        res = select_sse2(use_fg, fg, select_sse2(use_bg, bg, res));
+        _mm_storeu_si128((__m128i *)&dest[x], res);
+    }
+
+    lv_color32_t * dest_c32 = (lv_color32_t *)dest;
+    for(; x < w; x++) {
+        lv_color32_t fg;
+        lv_memcpy(&fg, src ? &src[x] : &color, sizeof(fg));
+        fg.alpha = get_alpha(mode, fg.alpha, mask ? mask[x] : 0, opa);
+        dest_c32[x] = mix_32_32(fg, dest_c32[x]);
+    }
+}
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+/*Convert 8 pixels with the coefficients of `lv_draw_sw_yuv_to_color32()`.
+ *`y_v`, `d_v` and `e_v` have Y - 16, U - 128 and V - 128 in 16 bit lanes.*/
+static inline void SSE2_FUNC yuv_to_argb8888_x8_sse2(__m128i y_v, __m128i d_v, __m128i e_v, uint32_t * dest)
+{
+    const __m128i r_coef = _mm_setr_epi16(298, 409, 298, 409, 298, 409, 298, 409);
+    const __m128i g_coef1 = _mm_setr_epi16(298, -100, 298, -100, 298, -100, 298, -100);
+    const __m128i g_coef2 = _mm_setr_epi16(-208, 128, -208, 128, -208, 128, -208, 128);
+    const __m128i b_coef = _mm_setr_epi16(298, 516, 298, 516, 298, 516, 298, 516);
+    const __m128i round = _mm_set1_epi32(128);
+    const __m128i one = _mm_set1_epi16(1);
+
+    /*The products are summed in 32 bit lanes by `madd`, so they don't overflow*/
+    __m128i ye_lo = _mm_unpacklo_epi16(y_v, e_v);
+    __m128i ye_hi = _mm_unpackhi_epi16(y_v, e_v);
+    __m128i yd_lo = _mm_unpacklo_epi16(y_v, d_v);
+    __m128i yd_hi = _mm_unpackhi_epi16(y_v, d_v);
+    __m128i e1_lo = _mm_unpacklo_epi16(e_v, one);
+    __m128i e1_hi = _mm_unpackhi_epi16(e_v, one);
+
+    __m128i r_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ye_lo, r_coef), round), 8);
+    __m128i r_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(ye_hi, r_coef), round), 8);
+    __m128i g_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yd_lo, g_coef1), _mm_madd_epi16(e1_lo, g_coef2)), 8);
+    __m128i g_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yd_hi, g_coef1), _mm_madd_epi16(e1_hi, g_coef2)), 8);
+    __m128i b_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yd_lo, b_coef), round), 8);
+    __m128i b_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yd_hi, b_coef), round), 8);
+
+    /*Clamp to 0..255 by the saturating packs*/
+    __m128i r = _mm_packus_epi16(_mm_packs_epi32(r_lo, r_hi), _mm_setzero_si128());
+    __m128i g = _mm_packus_epi16(_mm_packs_epi32(g_lo, g_hi), _mm_setzero_si128());
+    __m128i b = _mm_packus_epi16(_mm_packs_epi32(b_lo, b_hi), _mm_setzero_si128());
+
+    __m128i bg = _mm_unpacklo_epi8(b, g);
+    __m128i ra = _mm_unpacklo_epi8(r, _mm_set1_epi8((char)0xFF));
+    _mm_storeu_si128((__m128i *)&dest[0], _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128((__m128i *)&dest[4], _mm_unpackhi_epi16(bg, ra));
+}
+
+static void SSE2_FUNC yuv_to_argb8888_row_sse2(const lv_draw_sw_yuv_planes_t * planes, int32_t x, int32_t y, int32_t w,
+                                               uint32_t * dest)
+{
+    const uint8_t * y_row = planes->y + y * planes->y_stride;
+    const uint8_t * u_row = planes->u ? planes->u + (y >> planes->c_shift_y) * planes->u_stride : NULL;
+    const uint8_t * v_row = planes->v ? planes->v + (y >> planes->c_shift_y) * planes->v_stride : NULL;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i y_ofs = _mm_set1_epi16(16);
+    const __m128i c_ofs = _mm_set1_epi16(128);
+
+    int16_t y_buf[8];
+    int16_t u_buf[8];
+    int16_t v_buf[8];
+    int32_t i = 0;
+    for(; i <= w - 8; i += 8) {
+        __m128i y_v;
+        int32_t k;
+        if(planes->y_step == 1) {
+            y_v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&y_row[x + i]), zero);
+        }
+        else {
+            /*The luma of the packed formats is interleaved with the chroma*/
+            for(k = 0; k < 8; k++) y_buf[k] = y_row[(x + i + k) * planes->y_step];
+            y_v = _mm_loadu_si128((const __m128i *)y_buf);
+        }
+
+        __m128i d_v = zero;
+        __m128i e_v = zero;
+        if(u_row) {
+            for(k = 0; k < 8; k++) {
+                int32_t cx = ((x + i + k) >> planes->c_shift_x) * planes->c_step;
+                u_buf[k] = u_row[cx];
+                v_buf[k] = v_row[cx];
+            }
+            d_v = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)u_buf), c_ofs);
+            e_v = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)v_buf), c_ofs);
+        }
+
+        yuv_to_argb8888_x8_sse2(_mm_sub_epi16(y_v, y_ofs), d_v, e_v, &dest[i]);
+    }
+
+    if(i < w) lv_draw_sw_yuv_to_argb8888_row(planes, x + i, y, w - i, (lv_color32_t *)&dest[i]);
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
+/*--------------------
+ * AVX2
+ *--------------------*/
+
+static inline __m256i AVX2_FUNC select_avx2(__m256i sel, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, sel);
+}
+
+/*Get the mix ratio of 8 pixels in 32 bit lanes. `opa_v` has `opa` in each 32 bit lane.*/
+static inline __m256i AVX2_FUNC alpha_x8_avx2(alpha_mode_t mode, __m256i src, const lv_opa_t * mask, __m256i opa_v)
+{
+    __m256i mask_v = _mm256_setzero_si256();
+    if(mode == ALPHA_MASK || mode == ALPHA_MASK_OPA || mode == ALPHA_SRC_MASK || mode == ALPHA_SRC_MASK_OPA) {
+        mask_v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+    }
+
+    switch(mode) {
+        case ALPHA_OPA:
+            return opa_v;
+        case ALPHA_MASK:
+            return mask_v;
+        case ALPHA_MASK_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(mask_v, opa_v), 8);
+        case ALPHA_SRC:
+            return _mm256_srli_epi32(src, 24);
+        case ALPHA_SRC_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(_mm256_srli_epi32(src, 24), opa_v), 8);
+        case ALPHA_SRC_MASK:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(_mm256_srli_epi32(src, 24), mask_v), 8);
+        default:
+            return _mm256_mulhi_epu16(_mm256_mullo_epi16(_mm256_srli_epi32(src, 24), mask_v), opa_v);
+    }
+}
+
+/*Get the mix ratio of 16 pixels in 16 bit lanes. `opa_v` has `opa` in each 16 bit lane.*/
+static inline __m256i AVX2_FUNC alpha_x16_avx2(alpha_mode_t mode, const lv_opa_t * mask, __m256i opa_v)
+{
+    switch(mode) {
+        case ALPHA_MASK:
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)mask));
+        case ALPHA_MASK_OPA:
+            return _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)mask)),
+                                                        opa_v), 8);
+        default:
+            return opa_v;
+    }
+}
+
+static void AVX2_FUNC fill_u16_avx2(uint16_t * dest, uint16_t color, int32_t w)
+{
+    __m256i color_v = _mm256_set1_epi16((short)color);
+    int32_t x = 0;
+    for(; x <= w - 16; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+    }
+    fill_u16_sse2(&dest[x], color, w - x);
+}
+
+static void AVX2_FUNC fill_u32_avx2(uint32_t * dest, uint32_t color, int32_t w)
+{
+    __m256i color_v = _mm256_set1_epi32((int)color);
+    int32_t x = 0;
+    for(; x <= w - 8; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+    }
+    fill_u32_sse2(&dest[x], color, w - x);
+}
+
+/*See rgb565_mix_x4_sse2()*/
+static inline __m256i AVX2_FUNC rgb565_mix_x8_avx2(__m256i fg, __m256i bg, __m256i mix)
+{
+    const __m256i ch_mask = _mm256_set1_epi32(0x07E0F81F);
+    fg = _mm256_and_si256(fg, ch_mask);
+    bg = _mm256_and_si256(bg, ch_mask);
+
+    __m256i diff = _mm256_sub_epi32(fg, bg);
+    __m256i prod = _mm256_add_epi32(_mm256_mullo_epi16(diff, mix),
+                                    _mm256_slli_epi32(_mm256_mulhi_epu16(diff, mix), 16));
+    __m256i res = _mm256_and_si256(_mm256_add_epi32(_mm256_srli_epi32(prod, 5), bg), ch_mask);
+    res = _mm256_or_si256(res, _mm256_srli_epi32(res, 16));
+
+    return _mm256_srai_epi32(_mm256_slli_epi32(res, 16), 16);
+}
+
+static void AVX2_FUNC rgb565_mix_row_avx2(uint16_t * dest, const uint16_t * src, uint16_t color,
+                                          const lv_opa_t * mask, lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    __m256i color_v = _mm256_set1_epi16((short)color);
+    __m256i opa_v = _mm256_set1_epi16(opa);
+    int32_t x = 0;
+    for(; x <= w - 16; x += 16) {
+        __m256i fg = src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i mix = alpha_x16_avx2(mode, mask ? &mask[x] : NULL, opa_v);
+
+        /*The unpacks and the pack work within the 128 bit lanes so the pixel order is kept*/
+        __m256i mix5 = _mm256_srli_epi16(_mm256_add_epi16(mix, _mm256_set1_epi16(4)), 3);
+        __m256i res_lo = rgb565_mix_x8_avx2(_mm256_unpacklo_epi16(fg, fg), _mm256_unpacklo_epi16(bg, bg),
+                                            _mm256_unpacklo_epi16(mix5, mix5));
+        __m256i res_hi = rgb565_mix_x8_avx2(_mm256_unpackhi_epi16(fg, fg), _mm256_unpackhi_epi16(bg, bg),
+                                            _mm256_unpackhi_epi16(mix5, mix5));
+        __m256i res = _mm256_packs_epi32(res_lo, res_hi);
+        res = select_avx2(_mm256_cmpeq_epi16(mix, _mm256_set1_epi16(255)), fg, res);
+
+        _mm256_storeu_si256((__m256i *)&dest[x], res);
+    }
+
+    rgb565_mix_row_sse2(&dest[x], src ? &src[x] : NULL, color, mask ? &mask[x] : NULL, opa, mode, w - x);
+}
+
+/*See mix_u8_sse2()*/
+static inline __m256i AVX2_FUNC mix_u8_avx2(__m256i fg, __m256i bg, __m256i a)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ff = _mm256_set1_epi16(255);
+
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    __m256i a_lo = _mm256_unpacklo_epi32(a, a);
+    __m256i a_hi = _mm256_unpackhi_epi32(a, a);
+
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), a_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), _mm256_sub_epi16(ff, a_lo)));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), a_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), _mm256_sub_epi16(ff, a_hi)));
+
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+static void AVX2_FUNC argb8888_mix_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                            const lv_opa_t * mask, lv_opa_t opa, alpha_mode_t mode, int32_t w)
+{
+    const __m256i rgb_mask = _mm256_set1_epi32(RGB_BITS);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)ALPHA_BITS);
+    const __m256i opa_min = _mm256_set1_epi32(LV_OPA_MIN + 1);
+    const __m256i opa_max = _mm256_set1_epi32(LV_OPA_MAX - 1);
+    __m256i color_v = _mm256_set1_epi32((int)color);
+    __m256i opa_v = _mm256_set1_epi32(opa);
+    int32_t x = 0;
+    for(; x <= w - 8; x += 8) {
+        __m256i fg = src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i a = alpha_x8_avx2(mode, fg, mask ? &mask[x] : NULL, opa_v);
+        fg = _mm256_or_si256(_mm256_and_si256(fg, rgb_mask), _mm256_slli_epi32(a, 24));
+
+        __m256i bg_a = _mm256_srli_epi32(bg, 24);
+        __m256i use_fg = _mm256_or_si256(_mm256_cmpgt_epi32(a, opa_max), _mm256_cmpgt_epi32(opa_min, bg_a));
+        __m256i use_bg = _mm256_andnot_si256(use_fg, _mm256_cmpgt_epi32(opa_min, a));
+        __m256i use_mix = _mm256_andnot_si256(_mm256_or_si256(use_fg, use_bg), _mm256_cmpeq_epi32(bg_a, _mm256_set1_epi32(255)));
+
+        if(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(use_fg, use_bg), use_mix)) != -1) {
+            lv_color32_t fg_px[8];
+            _mm256_storeu_si256((__m256i *)fg_px, fg);
+            lv_color32_t * dest_c32 = (lv_color32_t *)&dest[x];
+            uint32_t i;
+            for(i = 0; i < 8; i++) {
+                dest_c32[i] = mix_32_32(fg_px[i], dest_c32[i]);
+            }
+            continue;
+        }
+
+        __m256i res = _mm256_or_si256(mix_u8_avx2(fg, bg, a), alpha_mask);
+        res = select_avx2(use_fg, fg, select_avx2(use_bg, bg, res));
+        _mm256_storeu_si256((__m256i *)&dest[x], res);
+    }
+
+    argb8888_mix_row_sse2(&dest[x], src ? &src[x] : NULL, color, mask ? &mask[x] : NULL, opa, mode, w - x);
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
@@ -0,0 +1,280 @@
+/**
+ * @file lv_blend_x86.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_H
+#define LV_BLEND_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+/* detect whether the SSE2/AVX2 intrinsics can be compiled based on the compilers' standard defines */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#ifdef LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#include LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#endif
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_DRAW_SW_X86_SIMD_AVAILABLE   1
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    lv_color_blend_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    lv_color_blend_to_rgb565_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    lv_color_blend_to_rgb565_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_rgb565_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_mix_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_mix_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_mix_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size, src_px_size) \
+    lv_rgb888_blend_normal_to_rgb888_x86(dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size, src_px_size) \
+    lv_rgb888_blend_normal_to_rgb888_x86(dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size, src_px_size) \
+    lv_rgb888_blend_normal_to_rgb888_x86(dsc, dst_px_size, src_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size) \
+    lv_argb8888_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    lv_argb8888_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    lv_argb8888_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    lv_argb8888_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    lv_color_blend_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_color_blend_to_argb8888_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_color_blend_to_argb8888_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_argb8888_mix_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc) \
+    lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB565(dsc) \
+    lv_yuv_blend_normal_to_rgb565_x86(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB888
+#define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size) \
+    lv_yuv_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+#endif
+
+#ifndef LV_DRAW_SW_YUV_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_YUV_BLEND_NORMAL_TO_ARGB8888(dsc) \
+    lv_yuv_blend_normal_to_argb8888_x86(dsc)
+#endif
+
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_DRAW_SW_X86_SIMD_NONE,   /**< Use the C implementation*/
+    LV_DRAW_SW_X86_SIMD_SSE2,
+    LV_DRAW_SW_X86_SIMD_AVX2,
+} lv_draw_sw_x86_simd_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Query the CPU with CPUID to find the best supported instruction set and use it.
+ * Called by `lv_draw_sw_init()` before the render threads are started.
+ */
+void lv_draw_sw_x86_simd_init(void);
+
+/**
+ * Get the instruction set used by the x86 blend functions.
+ * @return      the instruction set in use
+ */
+lv_draw_sw_x86_simd_t lv_draw_sw_x86_simd_get_level(void);
+
+/**
+ * Limit the instruction set used by the x86 blend functions, e.g. to compare them with the C implementation.
+ * Levels not supported by the CPU are ignored and the best supported level is used instead.
+ * Call it only when nothing is being rendered.
+ * @param level     the highest instruction set to use
+ */
+void lv_draw_sw_x86_simd_set_level(lv_draw_sw_x86_simd_t level);
+
+lv_result_t lv_color_blend_to_rgb565_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_rgb565_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_rgb888_x86(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+
+lv_result_t lv_color_blend_to_rgb888_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+
+lv_result_t lv_rgb888_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size,
+                                                 uint32_t src_px_size);
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_color_blend_to_argb8888_mix_x86(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+lv_result_t lv_yuv_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+lv_result_t lv_yuv_blend_normal_to_rgb888_x86(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+
+lv_result_t lv_yuv_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc);
+
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* x86 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_H*/
@@ -10,6 +10,7 @@
 #include "../lv_draw_private.h"
 #if LV_USE_DRAW_SW
 
+#include "../../misc/lv_area_private.h"
 #include "../../core/lv_refr.h"
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
@@ -25,6 +26,8 @@
 
 #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "arm2d/lv_draw_sw_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+    #include "blend/x86/lv_blend_x86.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -38,6 +41,9 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*Don't split a draw task into bands thinner than this*/
+#define BAND_MIN_HEIGHT     8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -55,6 +61,13 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
 
+#if LV_DRAW_SW_USE_BANDS
+    static bool band_split(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t);
+    static bool is_image_splittable(const lv_draw_image_dsc_t * draw_dsc);
+    static bool band_steal(lv_draw_sw_unit_t * u);
+    static bool band_finish(lv_draw_sw_unit_t * u, bool * task_ready);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -75,6 +88,11 @@ void lv_draw_sw_init(void)
     lv_draw_sw_mask_init();
 #endif
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD && defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+    /*Detect the instruction set here as the render threads only read it*/
+    lv_draw_sw_x86_simd_init();
+#endif
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -84,6 +102,10 @@ void lv_draw_sw_init(void)
         draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
         draw_sw_unit->base_unit.name = "SW";
 
+#if LV_DRAW_SW_USE_BANDS
+        lv_mutex_init(&draw_sw_unit->band_lock);
+#endif
+
 #if LV_USE_OS
         lv_thread_init(&draw_sw_unit->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE, draw_sw_unit);
 #endif
@@ -117,7 +139,13 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
+    lv_result_t res = lv_thread_delete(&draw_sw_unit->thread);
+
+#if LV_DRAW_SW_USE_BANDS
+    lv_mutex_delete(&draw_sw_unit->band_lock);
+#endif
+
+    return res;
 #else
     LV_UNUSED(draw_unit);
     return 0;
@@ -129,9 +157,30 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
  **********************/
 static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
+    /*Save the time before the task can be marked as ready and the frame finished*/
+    LV_SYSMON_FRAME_STATS_TICK(exec_tick);
     execute_drawing(u);
+    LV_SYSMON_FRAME_STATS_ADD_EXEC(&u->base_unit, exec_tick);
+
+#if LV_DRAW_SW_USE_BANDS
+    if(u->band_owner) {
+        /*Render the remaining bands of the own split. The last rendered band finishes the task.*/
+        bool task_ready = false;
+        while(band_finish(u, &task_ready)) {
+            LV_SYSMON_FRAME_STATS_TICK(band_tick);
+            execute_drawing(u);
+            LV_SYSMON_FRAME_STATS_ADD_EXEC(&u->base_unit, band_tick);
+        }
 
+        if(task_ready) u->task_act->state = LV_DRAW_TASK_STATE_READY;
+        u->band_owner = NULL;
+    }
+    else {
+        u->task_act->state = LV_DRAW_TASK_STATE_READY;
+    }
+#else
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
+#endif
     u->task_act = NULL;
 
     /*The draw unit is free now. Request a new dispatching as it can get a new task*/
@@ -187,6 +236,15 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         return 0;
     }
 
+#if LV_DRAW_SW_USE_BANDS
+    /*Help the other draw units to finish their large draw tasks first*/
+    if(band_steal(draw_sw_unit)) {
+        if(draw_sw_unit->inited) lv_thread_sync_signal(&draw_sw_unit->sync);
+        LV_PROFILER_DRAW_END;
+        return 1;
+    }
+#endif
+
     lv_draw_task_t * t = NULL;
     t = lv_draw_get_next_available_task(layer, NULL, DRAW_UNIT_ID_SW);
     if(t == NULL) {
@@ -203,6 +261,11 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->base_unit.target_layer = layer;
     draw_sw_unit->base_unit.clip_area = &t->clip_area;
+#if LV_DRAW_SW_USE_BANDS
+    if(band_split(draw_sw_unit, layer, t)) {
+        draw_sw_unit->base_unit.clip_area = &draw_sw_unit->band_area;
+    }
+#endif
     draw_sw_unit->task_act = t;
 
 #if LV_USE_OS
@@ -340,4 +403,149 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
     LV_PROFILER_DRAW_END;
 }
 
+#if LV_DRAW_SW_USE_BANDS
+
+/**
+ * Split a large draw task into horizontal bands and take the first band
+ * @param u         pointer to the draw unit which has taken the draw task
+ * @param layer     the layer of the draw task
+ * @param t         pointer to a draw task
+ * @return          true: the task was split and `u->band_area` is set; false: render the task at once
+ */
+static bool band_split(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t)
+{
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            break;
+        case LV_DRAW_TASK_TYPE_LAYER:
+            if(!is_image_splittable(t->draw_dsc)) return false;
+            break;
+        case LV_DRAW_TASK_TYPE_IMAGE: {
+                /*Each band opens the image so split only the images which don't need real decoding*/
+                lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+                if(!is_image_splittable(draw_dsc)) return false;
+                if(lv_image_src_get_type(draw_dsc->src) != LV_IMAGE_SRC_VARIABLE) return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < LV_DRAW_SW_BAND_SPLIT_MIN_AREA) return false;
+
+    int32_t h = lv_area_get_height(&draw_area);
+    int32_t band_cnt = LV_MIN(LV_DRAW_SW_BAND_CNT_MAX, h / BAND_MIN_HEIGHT);
+    if(band_cnt < 2) return false;
+
+    lv_mutex_lock(&u->band_lock);
+
+    /*The bands of the previous split are still being rendered by the other draw units*/
+    if(u->band_pending) {
+        lv_mutex_unlock(&u->band_lock);
+        return false;
+    }
+
+    /*The first and last bands are extended to the clip area to cover everything the task might draw*/
+    int32_t i;
+    for(i = 0; i < band_cnt; i++) {
+        lv_area_t * band = &u->bands[i];
+        band->x1 = t->clip_area.x1;
+        band->x2 = t->clip_area.x2;
+        band->y1 = i == 0 ? t->clip_area.y1 : draw_area.y1 + (h * i) / band_cnt;
+        band->y2 = i == band_cnt - 1 ? t->clip_area.y2 : draw_area.y1 + (h * (i + 1)) / band_cnt - 1;
+    }
+
+    u->split_task = t;
+    u->split_layer = layer;
+    u->band_first = 1;
+    u->band_last = band_cnt;
+    u->band_pending = band_cnt;
+    u->band_area = u->bands[0];
+    u->band_owner = u;
+
+    lv_mutex_unlock(&u->band_lock);
+
+    return true;
+}
+
+/**
+ * Check if an image or layer gives the same result if it's drawn band by band
+ * @param draw_dsc  pointer to an image draw descriptor
+ * @return          true: the image can be split into bands
+ */
+static bool is_image_splittable(const lv_draw_image_dsc_t * draw_dsc)
+{
+    /*The bitmap mask is applied on the whole layer, so it can't be done by each band*/
+    if(draw_dsc->bitmap_mask_src) return false;
+
+    /*The transformation steps are calculated from the height of the drawn area,
+     *so different bands would slightly change the rounding*/
+    if(draw_dsc->rotation || draw_dsc->skew_x || draw_dsc->skew_y ||
+       draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Take a band from the back of another draw unit's bands
+ * @param u         pointer to an idle draw unit
+ * @return          true: a band was stolen and `u` is ready to render it
+ */
+static bool band_steal(lv_draw_sw_unit_t * u)
+{
+    lv_draw_unit_t * unit = _draw_info.unit_head;
+    while(unit) {
+        lv_draw_sw_unit_t * victim = (lv_draw_sw_unit_t *)unit;
+        if(unit->dispatch_cb == dispatch && victim != u) {
+            lv_mutex_lock(&victim->band_lock);
+            if(victim->band_first < victim->band_last) {
+                victim->band_last--;
+                u->band_area = victim->bands[victim->band_last];
+                u->band_owner = victim;
+                u->base_unit.target_layer = victim->split_layer;
+                u->base_unit.clip_area = &u->band_area;
+                u->task_act = victim->split_task;
+                lv_mutex_unlock(&victim->band_lock);
+                return true;
+            }
+            lv_mutex_unlock(&victim->band_lock);
+        }
+        unit = unit->next;
+    }
+
+    return false;
+}
+
+/**
+ * Mark the band rendered by a draw unit as finished and take the next band of its own split if any
+ * @param u             pointer to a draw unit which has rendered a band
+ * @param task_ready    set to true if it was the last band of the draw task
+ * @return              true: a new band was taken to `u->band_area`
+ */
+static bool band_finish(lv_draw_sw_unit_t * u, bool * task_ready)
+{
+    lv_draw_sw_unit_t * owner = u->band_owner;
+    bool band_taken = false;
+
+    lv_mutex_lock(&owner->band_lock);
+    owner->band_pending--;
+    if(owner->band_pending == 0) {
+        *task_ready = true;
+    }
+    else if(owner == u && u->band_first < u->band_last) {
+        u->band_area = u->bands[u->band_first];
+        u->band_first++;
+        band_taken = true;
+    }
+    lv_mutex_unlock(&owner->band_lock);
+
+    return band_taken;
+}
+
+#endif /*LV_DRAW_SW_USE_BANDS*/
+
 #endif /*LV_USE_DRAW_SW*/
@@ -224,7 +224,12 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     blend_dsc.blend_mode = draw_dsc->blend_mode;
     blend_dsc.src_stride = img_stride;
 
-    if(!transformed && !radius && cf == LV_COLOR_FORMAT_A8) {
+    /*Transformed, clipped or recolored YUV images are converted to ARGB8888 by the transformation.
+     *The other ones are blended directly in the "simplest case" below.*/
+    if(LV_COLOR_FORMAT_IS_YUV(cf) && (transformed || radius || draw_dsc->recolor_opa > LV_OPA_MIN)) {
+        transform_and_recolor(draw_unit, draw_dsc, decoder_dsc, sup, img_coords, clipped_img_area);
+    }
+    else if(!transformed && !radius && cf == LV_COLOR_FORMAT_A8) {
         lv_area_t clipped_coords;
         if(!lv_area_intersect(&clipped_coords, img_coords, draw_unit->clip_area)) return;
 
@@ -463,6 +468,7 @@ static void transform_and_recolor(lv_draw_unit_t * draw_unit, const lv_draw_imag
     if(cf_final == LV_COLOR_FORMAT_RGB888 || cf_final == LV_COLOR_FORMAT_XRGB8888) cf_final = LV_COLOR_FORMAT_ARGB8888;
     else if(cf_final == LV_COLOR_FORMAT_RGB565) cf_final = LV_COLOR_FORMAT_RGB565A8;
     else if(cf_final == LV_COLOR_FORMAT_L8) cf_final = LV_COLOR_FORMAT_AL88;
+    else if(LV_COLOR_FORMAT_IS_YUV(cf_final)) cf_final = LV_COLOR_FORMAT_ARGB8888;
 
     uint8_t * transformed_buf;
     int32_t buf_h;
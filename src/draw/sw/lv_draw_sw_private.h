@@ -23,6 +23,11 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Splitting draw tasks into bands makes sense only if there are multiple render threads*/
+#define LV_DRAW_SW_USE_BANDS    (LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_BAND_SPLIT_MIN_AREA > 0)
+
+#define LV_DRAW_SW_BAND_CNT_MAX (LV_DRAW_SW_DRAW_UNIT_CNT * 2)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,6 +46,30 @@ struct _lv_draw_sw_unit_t {
     volatile bool exit_status;
 #endif
     uint32_t idx;
+
+#if LV_DRAW_SW_USE_BANDS
+    /** The band of `task_act` to render if it was split*/
+    lv_area_t band_area;
+
+    /** The draw unit which has split `task_act`. NULL if `task_act` is rendered at once.*/
+    lv_draw_sw_unit_t * band_owner;
+
+    /** The draw task split by this draw unit*/
+    lv_draw_task_t * split_task;
+    lv_layer_t * split_layer;
+
+    /** The bands of `split_task` not taken yet. This draw unit takes them from the front,
+     *  the other draw units steal them from the back.*/
+    lv_area_t bands[LV_DRAW_SW_BAND_CNT_MAX];
+    uint32_t band_first;
+    uint32_t band_last;
+
+    /** Number of bands of `split_task` not rendered yet*/
+    uint32_t band_pending;
+
+    /** Protects the bands. Locked by the other draw units too when they steal a band.*/
+    lv_mutex_t band_lock;
+#endif
 };
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
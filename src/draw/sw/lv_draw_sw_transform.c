@@ -14,6 +14,7 @@
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
+#include "blend/lv_draw_sw_blend_private.h"
 
 /*********************
  *      DEFINES
@@ -37,6 +38,7 @@ typedef struct {
     lv_point_t pivot;
 } point_transform_dsc_t;
 
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -83,6 +85,12 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
 #endif
 #endif /*LV_DRAW_SW_SUPPORT_L8*/
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+static void transform_yuv(const void * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                          int32_t x_end, uint8_t * dest_buf, bool aa, lv_color_format_t src_cf);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -130,7 +138,7 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
 
     int32_t dest_stride_a8 = dest_w;
     int32_t dest_stride;
-    if(src_cf == LV_COLOR_FORMAT_RGB888) {
+    if(src_cf == LV_COLOR_FORMAT_RGB888 || LV_COLOR_FORMAT_IS_YUV(src_cf)) {
         dest_stride = dest_w * lv_color_format_get_size(LV_COLOR_FORMAT_ARGB8888);
     }
     else if((src_cf == LV_COLOR_FORMAT_RGB565A8) || (src_cf == LV_COLOR_FORMAT_L8)) {
@@ -269,6 +277,20 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
                 transform_l8_to_al88(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
                 break;
 #endif /*LV_DRAW_SW_SUPPORT_L8 && (LV_DRAW_SW_SUPPORT_ARGB8888 || LV_DRAW_SW_SUPPORT_AL88)*/
+
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+            case LV_COLOR_FORMAT_I420:
+            case LV_COLOR_FORMAT_I422:
+            case LV_COLOR_FORMAT_I444:
+            case LV_COLOR_FORMAT_I400:
+            case LV_COLOR_FORMAT_NV21:
+            case LV_COLOR_FORMAT_NV12:
+            case LV_COLOR_FORMAT_YUY2:
+            case LV_COLOR_FORMAT_UYVY:
+                transform_yuv(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                              src_cf);
+                break;
+#endif
             default:
                 LV_LOG_WARN("Color format 0x%02X is not enabled. "
                             "See lv_color.h to find the name of the color formats and "
@@ -752,6 +774,112 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
 
 #endif /*LV_DRAW_SW_SUPPORT_L8 && LV_DRAW_SW_SUPPORT_AL88*/
 
+#if LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888
+
+static inline lv_color32_t yuv_get_px(const lv_draw_sw_yuv_planes_t * p, int32_t x, int32_t y)
+{
+    int32_t luma = p->y[y * p->y_stride + x * p->y_step];
+    if(p->u == NULL) return lv_draw_sw_yuv_to_color32(luma, 128, 128);
+
+    int32_t cx = (x >> p->c_shift_x) * p->c_step;
+    int32_t cy = y >> p->c_shift_y;
+    return lv_draw_sw_yuv_to_color32(luma, p->u[cy * p->u_stride + cx], p->v[cy * p->v_stride + cx]);
+}
+
+static void transform_yuv(const void * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                          int32_t x_end, uint8_t * dest_buf, bool aa, lv_color_format_t src_cf)
+{
+    lv_draw_sw_yuv_planes_t planes;
+    lv_draw_sw_yuv_planes_init(&planes, src, src_stride, src_cf);
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+
+    int32_t xs_ups_start = xs_ups;
+    int32_t ys_ups_start = ys_ups;
+
+    /*Not transformed row on the centers of the pixels: convert the pixels directly*/
+    int32_t xs_int_start = xs_ups >> 8;
+    int32_t ys_int_start = ys_ups >> 8;
+    if(xs_step == 256 * 256 && ys_step == 0 && (xs_ups & 0xFF) == 0x80 && (ys_ups & 0xFF) == 0x80 &&
+       xs_int_start >= 0 && xs_int_start + x_end <= src_w && ys_int_start >= 0 && ys_int_start < src_h) {
+        lv_draw_sw_yuv_to_argb8888_row(&planes, xs_int_start, ys_int_start, x_end, dest_c32);
+        return;
+    }
+
+    int32_t x;
+    for(x = 0; x < x_end; x++) {
+        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
+        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+
+        int32_t xs_int = xs_ups >> 8;
+        int32_t ys_int = ys_ups >> 8;
+
+        /*Fully out of the image*/
+        if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+            ((uint32_t *)dest_buf)[x] = 0x00000000;
+            continue;
+        }
+
+        /*Get the direction the hor and ver neighbor
+         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
+        int32_t xs_fract = xs_ups & 0xFF;
+        int32_t ys_fract = ys_ups & 0xFF;
+
+        int32_t x_next;
+        int32_t y_next;
+        if(xs_fract < 0x80) {
+            x_next = -1;
+            xs_fract = 0x7F - xs_fract;
+        }
+        else {
+            x_next = 1;
+            xs_fract = xs_fract - 0x80;
+        }
+        if(ys_fract < 0x80) {
+            y_next = -1;
+            ys_fract = 0x7F - ys_fract;
+        }
+        else {
+            y_next = 1;
+            ys_fract = ys_fract - 0x80;
+        }
+
+        dest_c32[x] = yuv_get_px(&planes, xs_int, ys_int);
+
+        if(aa &&
+           xs_int + x_next >= 0 &&
+           xs_int + x_next <= src_w - 1 &&
+           ys_int + y_next >= 0 &&
+           ys_int + y_next <= src_h - 1) {
+            lv_color32_t px_hor = yuv_get_px(&planes, xs_int + x_next, ys_int);
+            lv_color32_t px_ver = yuv_get_px(&planes, xs_int, ys_int + y_next);
+
+            if(!lv_color32_eq(dest_c32[x], px_ver)) {
+                px_ver.alpha = ys_fract;
+                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+            }
+
+            if(!lv_color32_eq(dest_c32[x], px_hor)) {
+                px_hor.alpha = xs_fract;
+                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+            }
+        }
+        /*Partially out of the image*/
+        else {
+            lv_opa_t a = 0xff;
+
+            if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
+                dest_c32[x].alpha = (a * (0xFF - xs_fract)) >> 8;
+            }
+            else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
+                dest_c32[x].alpha = (a * (0xFF - ys_fract)) >> 8;
+            }
+        }
+    }
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_YUV && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout)
 {
@@ -23,6 +23,8 @@
 #include <drm_fourcc.h>
 
 #include "../../../stdlib/lv_sprintf.h"
+#include "../../../display/lv_display_private.h"
+#include "../../../misc/lv_area_private.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +37,10 @@
     #error LV_COLOR_DEPTH not supported
 #endif
 
+#if LV_LINUX_DRM_BUFFER_COUNT != 2 && LV_LINUX_DRM_BUFFER_COUNT != 3
+    #error LV_LINUX_DRM_BUFFER_COUNT must be 2 or 3
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -45,6 +51,7 @@ typedef struct {
     unsigned long int size;
     uint8_t * map;
     uint32_t fb_handle;
+    lv_draw_buf_t draw_buf;
 } drm_buffer_t;
 
 typedef struct {
@@ -67,7 +74,15 @@ typedef struct {
     drmModePropertyPtr plane_props[128];
     drmModePropertyPtr crtc_props[128];
     drmModePropertyPtr conn_props[128];
-    drm_buffer_t drm_bufs[2]; /*DUMB buffers*/
+    drm_buffer_t drm_bufs[LV_LINUX_DRM_BUFFER_COUNT]; /*DUMB buffers*/
+    drm_buffer_t * front_buf;           /*The buffer on the screen*/
+    drm_buffer_t * pending_buf;         /*The buffer waiting for the page flip*/
+    lv_area_t * damage;                 /*The areas flushed in the current frame*/
+    uint32_t damage_cnt;
+    uint32_t damage_cap;
+    lv_area_t * prev_damage;            /*The areas flushed in the previous frame*/
+    uint32_t prev_damage_cnt;
+    uint32_t prev_damage_cap;
 } drm_dev_t;
 
 /**********************
@@ -94,6 +109,10 @@ static int drm_allocate_dumb(drm_dev_t * drm_dev, drm_buffer_t * buf);
 static int drm_setup_buffers(drm_dev_t * drm_dev);
 static void drm_flush_wait(lv_display_t * drm_dev);
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void drm_add_damage(drm_dev_t * drm_dev, const lv_area_t * area);
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+    static void drm_set_next_buf(lv_display_t * disp, drm_buffer_t * flushed_buf);
+#endif
 
 static uint32_t tick_get_cb(void);
 
@@ -127,7 +146,9 @@ lv_display_t * lv_linux_drm_create(void)
     }
     drm_dev->fd = -1;
     lv_display_set_driver_data(disp, drm_dev);
+#if LV_LINUX_DRM_BUFFER_COUNT == 2
     lv_display_set_flush_wait_cb(disp, drm_flush_wait);
+#endif
     lv_display_set_flush_cb(disp, drm_flush);
 
     return disp;
@@ -159,13 +180,21 @@ void lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_t conne
     int32_t ver_res = drm_dev->height;
     int32_t width = drm_dev->mmWidth;
 
-    size_t buf_size = LV_MIN(drm_dev->drm_bufs[1].size, drm_dev->drm_bufs[0].size);
     /* Resolution must be set first because if the screen is smaller than the size passed
      * to lv_display_create then the buffers aren't big enough for LV_DISPLAY_RENDER_MODE_DIRECT.
      */
     lv_display_set_resolution(disp, hor_res, ver_res);
-    lv_display_set_buffers(disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
-                           LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    /* Use the pitch of the DUMB buffers as stride as it can be larger than the width */
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    for(int idx = 0; idx < LV_LINUX_DRM_BUFFER_COUNT; idx++) {
+        drm_buffer_t * buf = &drm_dev->drm_bufs[idx];
+        lv_draw_buf_init(&buf->draw_buf, hor_res, ver_res, cf, buf->pitch, buf->map, buf->size);
+    }
+
+    /* With 3 buffers the third one is swapped in after every flush (see drm_set_next_buf) */
+    lv_display_set_draw_buffers(disp, &drm_dev->drm_bufs[1].draw_buf, &drm_dev->drm_bufs[0].draw_buf);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
 
     if(width) {
         lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 25400, width * 1000));
@@ -237,6 +266,11 @@ static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec
         drmModeAtomicFree(drm_dev->req);
         drm_dev->req = NULL;
     }
+
+    if(drm_dev->pending_buf) {
+        drm_dev->front_buf = drm_dev->pending_buf;
+        drm_dev->pending_buf = NULL;
+    }
 }
 
 static int drm_get_plane_props(drm_dev_t * drm_dev)
@@ -363,6 +397,7 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
 {
     int ret;
     static int first = 1;
+    uint32_t damage_blob_id = 0;
     uint32_t flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
 
     drm_dev->req = drmModeAtomicAlloc();
@@ -390,13 +425,47 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_add_plane_property(drm_dev, "CRTC_W", drm_dev->width);
     drm_add_plane_property(drm_dev, "CRTC_H", drm_dev->height);
 
+    /* Tell the driver which areas have changed compared to the previous frame.
+     * It's optional, so don't complain if the plane doesn't support it. */
+    struct drm_mode_rect * clips = NULL;
+    if(drm_dev->damage_cnt > 0 && get_plane_property_id(drm_dev, "FB_DAMAGE_CLIPS")) {
+        clips = lv_malloc(sizeof(struct drm_mode_rect) * drm_dev->damage_cnt);
+        LV_ASSERT_MALLOC(clips);
+    }
+
+    if(clips) {
+        uint32_t i;
+        for(i = 0; i < drm_dev->damage_cnt; i++) {
+            clips[i].x1 = drm_dev->damage[i].x1;
+            clips[i].y1 = drm_dev->damage[i].y1;
+            clips[i].x2 = drm_dev->damage[i].x2 + 1;
+            clips[i].y2 = drm_dev->damage[i].y2 + 1;
+        }
+
+        if(drmModeCreatePropertyBlob(drm_dev->fd, clips, sizeof(clips[0]) * drm_dev->damage_cnt, &damage_blob_id)) {
+            LV_LOG_WARN("error creating damage clips blob");
+            damage_blob_id = 0;
+        }
+        else {
+            drm_add_plane_property(drm_dev, "FB_DAMAGE_CLIPS", damage_blob_id);
+        }
+        lv_free(clips);
+    }
+
     ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+
+    /* The commit holds a reference to the blob if it needs it */
+    if(damage_blob_id) drmModeDestroyPropertyBlob(drm_dev->fd, damage_blob_id);
+
     if(ret) {
         LV_LOG_ERROR("drmModeAtomicCommit failed: %s (%d)", strerror(errno), errno);
         drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
         return ret;
     }
 
+    drm_dev->pending_buf = buf;
+
     return 0;
 }
 
@@ -796,6 +865,12 @@ static int drm_setup_buffers(drm_dev_t * drm_dev)
     if(ret)
         return ret;
 
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[2]);
+    if(ret)
+        return ret;
+#endif
+
     return 0;
 }
 
@@ -824,24 +899,116 @@ static void drm_flush_wait(lv_display_t * disp)
 
 static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
-    if(!lv_display_flush_is_last(disp)) return;
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+
+    drm_add_damage(drm_dev, area);
+
+    if(!lv_display_flush_is_last(disp)) {
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+        lv_display_flush_ready(disp);
+#endif
+        return;
+    }
+
+    for(int idx = 0; idx < LV_LINUX_DRM_BUFFER_COUNT; idx++) {
+        drm_buffer_t * buf = &drm_dev->drm_bufs[idx];
+        if(buf->map != px_map) continue;
 
-    LV_UNUSED(area);
-    LV_UNUSED(px_map);
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+        /* Only one page flip can be pending. Usually it has finished while rendering this frame. */
+        drm_flush_wait(disp);
+#endif
+
+        /*Request buffer swap*/
+        if(drm_dmabuf_set_plane(drm_dev, buf)) {
+            LV_LOG_ERROR("Flush fail");
+        }
+        else
+            LV_LOG_TRACE("Flush done");
+
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+        drm_set_next_buf(disp, buf);
+        lv_display_flush_ready(disp);
+#endif
+        break;
+    }
+
+    /* Swap the arrays, the old areas of `prev_damage` are not needed anymore */
+    lv_area_t * damage = drm_dev->prev_damage;
+    uint32_t damage_cap = drm_dev->prev_damage_cap;
+    drm_dev->prev_damage = drm_dev->damage;
+    drm_dev->prev_damage_cap = drm_dev->damage_cap;
+    drm_dev->prev_damage_cnt = drm_dev->damage_cnt;
+    drm_dev->damage = damage;
+    drm_dev->damage_cap = damage_cap;
+    drm_dev->damage_cnt = 0;
+}
+
+/**
+ * Save a flushed area for the damage clips of the next page flip
+ * @param drm_dev   pointer to the DRM device
+ * @param area      the flushed area
+ */
+static void drm_add_damage(drm_dev_t * drm_dev, const lv_area_t * area)
+{
+    /* Grow like the invalidated areas of the display, so one clip is saved for each of them */
+    if(drm_dev->damage_cnt == drm_dev->damage_cap) {
+        uint32_t cap = drm_dev->damage_cap ? drm_dev->damage_cap * 2 : LV_INV_BUF_SIZE;
+        lv_area_t * damage = lv_realloc(drm_dev->damage, sizeof(lv_area_t) * cap);
+        LV_ASSERT_MALLOC(damage);
+        if(damage) {
+            drm_dev->damage = damage;
+            drm_dev->damage_cap = cap;
+        }
+    }
+
+    if(drm_dev->damage_cnt < drm_dev->damage_cap) {
+        drm_dev->damage[drm_dev->damage_cnt] = *area;
+        drm_dev->damage_cnt++;
+    }
+    else if(drm_dev->damage_cnt > 0) {
+        /*Out of memory, join the rest into the last one*/
+        lv_area_join(&drm_dev->damage[drm_dev->damage_cnt - 1], &drm_dev->damage[drm_dev->damage_cnt - 1], area);
+    }
+}
+
+#if LV_LINUX_DRM_BUFFER_COUNT == 3
+/**
+ * Let LVGL render the next frame into the buffer which is neither on the screen nor waiting
+ * for the page flip, so rendering doesn't need to wait for the page flip.
+ * @param disp          pointer to a display
+ * @param flushed_buf   the buffer which was just committed
+ */
+static void drm_set_next_buf(lv_display_t * disp, drm_buffer_t * flushed_buf)
+{
     drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
 
-    for(int idx = 0; idx < 2; idx++) {
-        if(drm_dev->drm_bufs[idx].map == px_map) {
-            /*Request buffer swap*/
-            if(drm_dmabuf_set_plane(drm_dev, &drm_dev->drm_bufs[idx])) {
-                LV_LOG_ERROR("Flush fail");
-                return;
-            }
-            else
-                LV_LOG_TRACE("Flush done");
+    drm_buffer_t * next_buf = NULL;
+    for(int idx = 0; idx < LV_LINUX_DRM_BUFFER_COUNT; idx++) {
+        drm_buffer_t * buf = &drm_dev->drm_bufs[idx];
+        if(buf != flushed_buf && buf != drm_dev->front_buf) {
+            next_buf = buf;
+            break;
         }
     }
+
+    /* LVGL copies the areas of the last frame from the flushed buffer to the next one,
+     * but the next buffer is one frame older, so copy the areas of the previous frame too.
+     * The flushed buffer already contains the whole frame. */
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                lv_display_get_vertical_resolution(disp) - 1);
+    for(uint32_t i = 0; i < drm_dev->prev_damage_cnt; i++) {
+        lv_area_t area;
+        if(lv_area_intersect(&area, &drm_dev->prev_damage[i], &disp_area)) {
+            lv_draw_buf_copy(&next_buf->draw_buf, &area, &flushed_buf->draw_buf, &area);
+        }
+    }
+
+    /* After flushing LVGL continues with the other draw buffer, so replace that one */
+    lv_display_set_next_draw_buffer(disp, &next_buf->draw_buf);
 }
+#endif
 
 static uint32_t tick_get_cb(void)
 {
@@ -65,6 +65,9 @@ typedef struct {
     long int screensize;
     int fbfd;
     bool force_refresh;
+    bool panning;               /*Render into the two halves of the framebuffer and pan between them*/
+    bool vsync_unsupported;
+    lv_draw_buf_t pan_bufs[2];
 } lv_linux_fb_t;
 
 /**********************
@@ -72,6 +75,10 @@ typedef struct {
  **********************/
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
+#if !LV_LINUX_FBDEV_BSD
+    static bool setup_panning(lv_linux_fb_t * dsc);
+    static void pan_display(lv_linux_fb_t * dsc, uint8_t * color_p);
+#endif
 static uint32_t tick_get_cb(void);
 
 /**********************
@@ -176,6 +183,10 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
         perror("Error reading variable information");
         return;
     }
+
+    if(LV_LINUX_FBDEV_USE_PANNING && LV_LINUX_FBDEV_RENDER_MODE != LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        dsc->panning = setup_panning(dsc);
+    }
 #endif /* LV_LINUX_FBDEV_BSD */
 
     LV_LOG_INFO("%dx%d, %dbpp", dsc->vinfo.xres, dsc->vinfo.yres, dsc->vinfo.bits_per_pixel);
@@ -213,6 +224,25 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
     int32_t hor_res = dsc->vinfo.xres;
     int32_t ver_res = dsc->vinfo.yres;
     int32_t width = dsc->vinfo.width;
+
+    if(dsc->panning) {
+        /* Render directly into the framebuffer. Start with the half which is not on the screen. */
+        lv_color_format_t cf = lv_display_get_color_format(disp);
+        uint32_t half_size = dsc->finfo.line_length * ver_res;
+        uint8_t * fbp = (uint8_t *)dsc->fbp;
+        lv_draw_buf_init(&dsc->pan_bufs[0], hor_res, ver_res, cf, dsc->finfo.line_length, fbp, half_size);
+        lv_draw_buf_init(&dsc->pan_bufs[1], hor_res, ver_res, cf, dsc->finfo.line_length, fbp + half_size, half_size);
+
+        lv_display_set_resolution(disp, hor_res, ver_res);
+        lv_display_set_draw_buffers(disp, &dsc->pan_bufs[1], &dsc->pan_bufs[0]);
+        lv_display_set_render_mode(disp, LV_LINUX_FBDEV_RENDER_MODE);
+
+        if(width > 0) {
+            lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 254, width * 10));
+        }
+        return;
+    }
+
     uint32_t draw_buf_size = hor_res * (dsc->vinfo.bits_per_pixel >> 3);
     if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
         draw_buf_size *= LV_LINUX_FBDEV_BUFFER_SIZE;
@@ -259,6 +289,15 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         return;
     }
 
+#if !LV_LINUX_FBDEV_BSD
+    if(dsc->panning) {
+        /* The areas are already rendered into the framebuffer, just show the new frame */
+        if(lv_display_flush_is_last(disp)) pan_display(dsc, color_p);
+        lv_display_flush_ready(disp);
+        return;
+    }
+#endif
+
     int32_t w = lv_area_get_width(area);
     int32_t h = lv_area_get_height(area);
     lv_color_format_t cf = lv_display_get_color_format(disp);
@@ -348,6 +387,64 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     lv_display_flush_ready(disp);
 }
 
+#if !LV_LINUX_FBDEV_BSD
+/**
+ * Make the virtual resolution twice as high as the screen so that LVGL can render into
+ * one half of the framebuffer while the other half is on the screen.
+ * @param dsc   pointer to the driver data
+ * @return      true: panning can be used; false: the framebuffer driver doesn't support it
+ */
+static bool setup_panning(lv_linux_fb_t * dsc)
+{
+    struct fb_var_screeninfo vinfo = dsc->vinfo;
+    vinfo.yres_virtual = vinfo.yres * 2;
+    vinfo.xoffset = 0;
+    vinfo.yoffset = 0;
+
+    if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &vinfo) == -1 ||
+       ioctl(dsc->fbfd, FBIOGET_VSCREENINFO, &dsc->vinfo) == -1 ||
+       ioctl(dsc->fbfd, FBIOGET_FSCREENINFO, &dsc->finfo) == -1) {
+        perror("Error setting the virtual resolution for panning");
+        return false;
+    }
+
+    /*The second half has to start at an offset which the driver can pan to*/
+    if(dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2 || dsc->finfo.ypanstep == 0 ||
+       dsc->vinfo.yres % dsc->finfo.ypanstep != 0 ||
+       dsc->finfo.smem_len < dsc->finfo.line_length * dsc->vinfo.yres * 2) {
+        LV_LOG_WARN("The framebuffer doesn't support panning, copying the rendered areas instead");
+        return false;
+    }
+
+    LV_LOG_INFO("Panning between two %" LV_PRIu32 " px high halves of the framebuffer", dsc->vinfo.yres);
+    return true;
+}
+
+/**
+ * Show the half of the framebuffer which was just rendered and wait for the vertical sync
+ * so that LVGL doesn't start to render into the half which is still on the screen.
+ * @param dsc       pointer to the driver data
+ * @param color_p   the rendered buffer, i.e. one of the halves
+ */
+static void pan_display(lv_linux_fb_t * dsc, uint8_t * color_p)
+{
+    dsc->vinfo.xoffset = 0;
+    dsc->vinfo.yoffset = color_p == dsc->pan_bufs[0].data ? 0 : dsc->vinfo.yres;
+    if(ioctl(dsc->fbfd, FBIOPAN_DISPLAY, &dsc->vinfo) == -1) {
+        perror("ioctl(FBIOPAN_DISPLAY)");
+    }
+
+    /* Not all drivers support it. Many of them wait for the vsync in FBIOPAN_DISPLAY anyway. */
+    if(!dsc->vsync_unsupported) {
+        uint32_t crtc = 0;
+        if(ioctl(dsc->fbfd, FBIO_WAITFORVSYNC, &crtc) == -1) {
+            LV_LOG_INFO("FBIO_WAITFORVSYNC is not supported");
+            dsc->vsync_unsupported = true;
+        }
+    }
+}
+#endif /* !LV_LINUX_FBDEV_BSD */
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
@@ -121,6 +121,9 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    lv_font_clear_glyph_id_cache_fmt_txt(font);
+    lv_font_clear_glyph_cache_fmt_txt(font);
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -8,6 +8,7 @@
  *********************/
 
 #include "lv_font.h"
+#include "lv_font_fmt_txt_private.h"
 #include "../misc/lv_text_private.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
@@ -56,6 +57,12 @@ void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
     if(font != NULL && font->release_glyph) {
         font->release_glyph(font, g_dsc);
     }
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    /*The built-in fonts have no `release_glyph` but their bitmap might be in the glyph cache*/
+    else if(font != NULL && font->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt) {
+        lv_font_fmt_txt_glyph_cache_release(g_dsc);
+    }
+#endif
 }
 
 bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
@@ -73,6 +80,7 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
 
     dsc_out->resolved_font = NULL;
     dsc_out->req_raw_bitmap = 0;
+    dsc_out->entry = NULL;
 
     while(f) {
         bool found = f->get_glyph_dsc(f, dsc_out, letter, f->kerning == LV_FONT_KERNING_NONE ? 0 : letter_next);
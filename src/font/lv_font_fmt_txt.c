@@ -13,6 +13,10 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_cache_private.h"
+#include "../misc/lv_iter.h"
+#include "../draw/lv_draw_buf_private.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -22,6 +26,30 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    #define glyph_id_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_id_cache
+
+    /*The draw units look up the glyph indices in their own threads, so instead of a lock the entries
+     *are validated by a sequence number (seqlock). A reader takes an entry being written as a miss and
+     *a writer doesn't store the glyph index if an other thread is writing the same entry.*/
+    #if LV_USE_OS == LV_OS_NONE
+        #define ATOMIC_LOAD(p, order)       (*(p))
+        #define ATOMIC_STORE(p, v, order)   (*(p) = (v))
+        #define ATOMIC_FENCE(order)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define ATOMIC_LOAD(p, order)       __atomic_load_n(p, order)
+        #define ATOMIC_STORE(p, v, order)   __atomic_store_n(p, v, order)
+        #define ATOMIC_FENCE(order)         __atomic_thread_fence(order)
+    #else
+        #error "LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0 with an OS requires the atomic builtins of GCC or Clang"
+    #endif
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    #define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+    #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,14 +58,42 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    uint8_t bpp;
+
+    lv_draw_buf_t * draw_buf;   /**< The glyph converted to A8*/
+} glyph_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    static inline bool glyph_id_cache_read(lv_font_fmt_txt_glyph_id_cache_entry_t * entry,
+                                           const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter, uint32_t * glyph_id);
+    static inline void glyph_id_cache_write(lv_font_fmt_txt_glyph_id_cache_entry_t * entry,
+                                            const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter, uint32_t glyph_id);
+#endif
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    static const lv_draw_buf_t * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * node, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+#endif
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
@@ -78,7 +134,6 @@ static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
     const lv_font_t * font = g_dsc->resolved_font;
-    uint8_t * bitmap_out = draw_buf->data;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
     uint32_t gid = g_dsc->gid.index;
@@ -91,6 +146,234 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    const lv_draw_buf_t * cached = get_cached_glyph(g_dsc);
+    if(cached) return cached;
+#endif
+
+    /*Not cached, e.g. the cache is full of glyphs being drawn. Render the glyph into the draw buffer*/
+    if(!decode_glyph(fdsc, gdsc, draw_buf->data)) return NULL;
+
+    return draw_buf;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    if(fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
+        /*Offset in the enum to the ALIGNED values */
+        dsc_out->format += LV_FONT_GLYPH_FORMAT_A1_ALIGNED - LV_FONT_GLYPH_FORMAT_A1;
+    }
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+void lv_font_clear_glyph_id_cache_fmt_txt(const lv_font_t * font)
+{
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE; i++) {
+        lv_font_fmt_txt_glyph_id_cache_entry_t * entry = &glyph_id_cache[i];
+        if(ATOMIC_LOAD(&entry->fdsc, __ATOMIC_RELAXED) == font->dsc) glyph_id_cache_write(entry, NULL, 0, 0);
+    }
+#else
+    LV_UNUSED(font);
+#endif
+}
+
+void lv_font_clear_glyph_cache_fmt_txt(const lv_font_t * font)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache == NULL) return;
+
+    lv_iter_t * iter = lv_cache_iter_create(glyph_cache);
+    if(iter == NULL) return;
+
+    /*The iterator copies the entry header too after the data*/
+    glyph_cache_data_t * elem = lv_malloc(lv_cache_entry_get_size(sizeof(glyph_cache_data_t)));
+    LV_ASSERT_MALLOC(elem);
+    if(elem == NULL) {
+        lv_iter_destroy(iter);
+        return;
+    }
+
+    /*Drop an entry only after the iterator stepped to the next one as dropping frees the node*/
+    glyph_cache_data_t to_drop;
+    bool drop = false;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        if(drop) lv_cache_drop(glyph_cache, &to_drop, NULL);
+        drop = elem->fdsc == font->dsc;
+        if(drop) to_drop = *elem;
+    }
+    if(drop) lv_cache_drop(glyph_cache, &to_drop, NULL);
+
+    lv_free(elem);
+    lv_iter_destroy(iter);
+#else
+    LV_UNUSED(font);
+#endif
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+
+void lv_font_fmt_txt_glyph_cache_init(void)
+{
+    if(glyph_cache != NULL) return;
+
+    glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t),
+    LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    });
+    LV_ASSERT_MALLOC(glyph_cache);
+
+    lv_cache_set_name(glyph_cache, "FONT_FMT_TXT_GLYPH");
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    if(glyph_cache == NULL) return;
+
+    lv_cache_destroy(glyph_cache, NULL);
+    glyph_cache = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    /*Consecutive characters are in consecutive entries as they are often used together (e.g. in a script)*/
+    uint32_t entry_id = (letter + (uint32_t)((lv_uintptr_t)fdsc >> 4)) % LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE;
+    lv_font_fmt_txt_glyph_id_cache_entry_t * entry = &glyph_id_cache[entry_id];
+
+    uint32_t glyph_id;
+    if(glyph_id_cache_read(entry, fdsc, letter, &glyph_id)) return glyph_id;
+
+    glyph_id = find_glyph_dsc_id(fdsc, letter);
+
+    /*Store the missing characters too as they are searched in every font of a fallback chain*/
+    glyph_id_cache_write(entry, fdsc, letter, glyph_id);
+    return glyph_id;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+
+/**
+ * Get the glyph index of a letter from a glyph index cache entry
+ * @param entry     pointer to a cache entry
+ * @param fdsc      the descriptor of the font
+ * @param letter    a UNICODE letter
+ * @param glyph_id  store the glyph index here
+ * @return          true: the entry has the glyph index of the letter;
+ *                  false: it has an other letter or it's being written
+ */
+static inline bool glyph_id_cache_read(lv_font_fmt_txt_glyph_id_cache_entry_t * entry,
+                                       const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter, uint32_t * glyph_id)
+{
+    uint32_t seq = ATOMIC_LOAD(&entry->seq, __ATOMIC_ACQUIRE);
+    if(seq & 1) return false;
+
+    bool hit = ATOMIC_LOAD(&entry->fdsc, __ATOMIC_RELAXED) == fdsc &&
+               ATOMIC_LOAD(&entry->letter, __ATOMIC_RELAXED) == letter;
+    *glyph_id = ATOMIC_LOAD(&entry->glyph_id, __ATOMIC_RELAXED);
+
+    /*If the entry was written meanwhile the values might belong to different letters*/
+    ATOMIC_FENCE(__ATOMIC_ACQUIRE);
+    return hit && ATOMIC_LOAD(&entry->seq, __ATOMIC_RELAXED) == seq;
+}
+
+/**
+ * Store the glyph index of a letter in a glyph index cache entry, unless an other thread is writing it
+ * @param entry     pointer to a cache entry
+ * @param fdsc      the descriptor of the font or NULL to clear the entry
+ * @param letter    a UNICODE letter
+ * @param glyph_id  the glyph index of the letter, 0 if it's not in the font
+ */
+static inline void glyph_id_cache_write(lv_font_fmt_txt_glyph_id_cache_entry_t * entry,
+                                        const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter, uint32_t glyph_id)
+{
+    uint32_t seq = ATOMIC_LOAD(&entry->seq, __ATOMIC_RELAXED);
+    if(seq & 1) return;
+
+#if LV_USE_OS == LV_OS_NONE
+    entry->seq = seq + 1;
+#else
+    if(!__atomic_compare_exchange_n(&entry->seq, &seq, seq + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return;
+    /*The readers need to see the odd sequence number before any of the new values*/
+    ATOMIC_FENCE(__ATOMIC_RELEASE);
+#endif
+
+    ATOMIC_STORE(&entry->fdsc, fdsc, __ATOMIC_RELAXED);
+    ATOMIC_STORE(&entry->letter, letter, __ATOMIC_RELAXED);
+    ATOMIC_STORE(&entry->glyph_id, glyph_id, __ATOMIC_RELAXED);
+    ATOMIC_STORE(&entry->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0*/
+
+/* Convert the bitmap of a glyph to A8 */
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * bitmap_out)
+{
     bool byte_aligned = fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN || fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
@@ -180,7 +463,7 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
                 bitmap_out_tmp += stride;
             }
         }
-        return draw_buf;
+        return true;
     }
     /*Handle compressed bitmap*/
     else {
@@ -188,76 +471,91 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return draw_buf;
+        return true;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+        return false;
 #endif
     }
-
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+
+/* Get the glyph from the glyph cache and render it into the cache if it's not there yet.
+ * The entry is kept in `g_dsc->entry` until `lv_font_fmt_txt_glyph_cache_release`. */
+static const lv_draw_buf_t * get_cached_glyph(lv_font_glyph_dsc_t * g_dsc)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
-    }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
+    if(glyph_cache == NULL) return NULL;
 
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
-    }
+    /*Don't hold the previous glyph if the bitmap is asked again with the same descriptor*/
+    lv_font_fmt_txt_glyph_cache_release(g_dsc);
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    const lv_font_fmt_txt_dsc_t * fdsc = g_dsc->resolved_font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[g_dsc->gid.index];
 
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+    search_key.fdsc = fdsc;
+    search_key.gid = g_dsc->gid.index;
+    search_key.bpp = fdsc->bpp;
 
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+    /*NULL if the glyph can't be added, e.g. it's larger than the cache*/
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache, &search_key, NULL);
+    if(entry == NULL) return NULL;
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+    g_dsc->entry = entry;
+    glyph_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    return cached_data->draw_buf;
+}
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    if(fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
-        /*Offset in the enum to the ALIGNED values */
-        dsc_out->format += LV_FONT_GLYPH_FORMAT_A1_ALIGNED - LV_FONT_GLYPH_FORMAT_A1;
-    }
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
+static bool glyph_cache_create_cb(glyph_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &node->fdsc->glyph_dsc[node->gid];
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h,
+                                                     LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return false;
 
+    if(!decode_glyph(node->fdsc, gdsc, draw_buf->data)) {
+        lv_draw_buf_destroy(draw_buf);
+        return false;
+    }
+
+    node->draw_buf = draw_buf;
     return true;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+    lv_draw_buf_destroy(node->draw_buf);
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
 {
-    if(letter == '\0') return 0;
+    if(lhs->fdsc != rhs->fdsc) {
+        return lhs->fdsc > rhs->fdsc ? 1 : -1;
+    }
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+
+    if(lhs->bpp != rhs->bpp) {
+        return lhs->bpp > rhs->bpp ? 1 : -1;
+    }
 
+    return 0;
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
+/* Search the glyph index of a character in the cmaps */
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -210,6 +210,20 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Remove the cached glyph indices of a font (see `LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE`).
+ * Needs to be called before freeing the descriptor of a font created at run time.
+ * @param font pointer to font
+ */
+void lv_font_clear_glyph_id_cache_fmt_txt(const lv_font_t * font);
+
+/**
+ * Drop the rendered glyphs of a font from the glyph cache (see `LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE`).
+ * Needs to be called before freeing the descriptor of a font created at run time.
+ * @param font pointer to font
+ */
+void lv_font_clear_glyph_cache_fmt_txt(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
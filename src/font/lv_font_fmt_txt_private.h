@@ -41,10 +41,38 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+/** A recently found glyph index of a character*/
+typedef struct {
+    uint32_t seq;                           /**< Incremented before and after writing, so odd while written*/
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font descriptor or NULL if the entry is empty*/
+    uint32_t letter;
+    uint32_t glyph_id;                      /**< 0 if `letter` is not in the font*/
+} lv_font_fmt_txt_glyph_id_cache_entry_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+/**
+ * Create the cache of the rendered glyphs (see `LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE`)
+ */
+void lv_font_fmt_txt_glyph_cache_init(void);
+
+/**
+ * Delete the cache of the rendered glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Release the cached bitmap returned by `lv_font_get_bitmap_fmt_txt`
+ * @param g_dsc     the glyph descriptor used to get the bitmap
+ */
+void lv_font_fmt_txt_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -40,26 +40,74 @@
 
 #define DECODER_BUFFER_SIZE (8 * 1024)
 
+/*Number of frames the decoding thread can keep ready. +1 frame is shown and +1 is being decoded*/
+#define FRAME_QUEUE_LEN         2
+#define FRAME_BUF_CNT           (FRAME_QUEUE_LEN + 2)
+
+/*Convert at least every Nth frame even if all of them are late*/
+#define FRAME_DROP_MAX          4
+
+#define DECODE_THREAD_STACK_SIZE    (32 * 1024)
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_OS
+typedef enum {
+    FRAME_STATE_FREE,
+    FRAME_STATE_DECODING,   /**< Owned by the decoding thread*/
+    FRAME_STATE_READY,      /**< Decoded, waiting for its PTS*/
+    FRAME_STATE_SHOWN,      /**< Used by the player's image*/
+} ffmpeg_frame_state_t;
+
+typedef struct {
+    lv_draw_buf_t * draw_buf;
+    int64_t pts;            /**< [ms]*/
+    ffmpeg_frame_state_t state;
+} ffmpeg_frame_t;
+#endif
+
 struct ffmpeg_context_s {
     AVIOContext * io_ctx;
     lv_fs_file_t lv_file;
     AVFormatContext * fmt_ctx;
     AVCodecContext * video_dec_ctx;
     AVStream * video_stream;
-    uint8_t * video_src_data[4];
     uint8_t * video_dst_data[4];
     struct SwsContext * sws_ctx;
     AVFrame * frame;
     AVPacket * pkt;
     int video_stream_idx;
-    int video_src_linesize[4];
     int video_dst_linesize[4];
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
+    bool dst_allocated;
     lv_draw_buf_t draw_buf;
+
+    int64_t frame_pts;          /**< PTS of the last decoded frame [ms]*/
+    int64_t drop_before_pts;    /**< Skip converting the frames before this PTS [ms]*/
+    bool frame_ready;           /**< The last decoded frame was converted to `video_dst_data`*/
+    bool frame_dropped;         /**< The last decoded frame was late and it was not converted*/
+
+#if LV_USE_OS
+    /*The player decodes in a thread. These fields are protected by `lock`*/
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;
+    ffmpeg_frame_t frames[FRAME_BUF_CNT];
+    uint32_t seek_gen;          /**< Incremented to rewind, the frames of the earlier generations are dropped*/
+    uint32_t thread_seek_gen;   /**< The generation the decoding thread has already rewound to*/
+    int64_t late_pts;           /**< The frames before this PTS can be dropped [ms]*/
+    bool eof;
+    bool thread_exit;
+    bool thread_running;
+
+    /*Only for the UI thread*/
+    int64_t clock_pts;          /**< The PTS of the playback at `clock_tick` [ms]*/
+    uint32_t clock_tick;
+    bool clock_valid;           /**< False until the first frame is shown after rewinding*/
+    bool clock_paused;
+#endif
 };
 
 #pragma pack(1)
@@ -87,6 +135,7 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx);
 static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx);
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx);
+static int ffmpeg_image_allocate_dst(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_get_image_header(lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 static int ffmpeg_get_frame_refr_period(struct ffmpeg_context_s * ffmpeg_ctx);
 static uint8_t * ffmpeg_get_image_data(struct ffmpeg_context_s * ffmpeg_ctx);
@@ -95,6 +144,15 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
 
+#if LV_USE_OS
+static lv_result_t ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx, lv_color_format_t cf, uint32_t stride);
+static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_thread_seek_start(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_thread_clock_pause(struct ffmpeg_context_s * ffmpeg_ctx, bool pause);
+static void ffmpeg_decode_thread_cb(void * user_data);
+static void ffmpeg_player_show_next_frame(lv_ffmpeg_player_t * player);
+#endif
+
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 
@@ -160,6 +218,8 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
 
     if(player->ffmpeg_ctx) {
+        /*The image cache might still use the frame of the old video*/
+        lv_image_cache_drop(&player->imgdsc);
         ffmpeg_close(player->ffmpeg_ctx);
         player->ffmpeg_ctx = NULL;
     }
@@ -176,6 +236,7 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     if(ffmpeg_image_allocate(player->ffmpeg_ctx) < 0) {
         LV_LOG_ERROR("ffmpeg image allocate failed");
         ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
         goto failed;
     }
 
@@ -191,7 +252,26 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     player->imgdsc.data_size = data_size;
     player->imgdsc.header.cf = has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
     player->imgdsc.header.stride = width * lv_color_format_get_size(player->imgdsc.header.cf);
+
+#if LV_USE_OS
+    /*Decode into the frame buffers of the decoding thread and show them directly*/
+    if(ffmpeg_thread_start(player->ffmpeg_ctx, player->imgdsc.header.cf,
+                           player->imgdsc.header.stride) != LV_RESULT_OK) {
+        LV_LOG_ERROR("ffmpeg decoding thread start failed");
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+        goto failed;
+    }
+    player->imgdsc.data = player->ffmpeg_ctx->frames[0].draw_buf->data;
+#else
+    if(ffmpeg_image_allocate_dst(player->ffmpeg_ctx) < 0) {
+        LV_LOG_ERROR("ffmpeg image allocate failed");
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+        goto failed;
+    }
     player->imgdsc.data = ffmpeg_get_image_data(player->ffmpeg_ctx);
+#endif
 
     lv_image_set_src(&player->img.obj, &(player->imgdsc));
 
@@ -226,22 +306,36 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
 
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
+#if LV_USE_OS
+            ffmpeg_thread_seek_start(player->ffmpeg_ctx);
+#else
             av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
                           0, 0, AVSEEK_FLAG_BACKWARD);
+#endif
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player start");
             break;
         case LV_FFMPEG_PLAYER_CMD_STOP:
+#if LV_USE_OS
+            ffmpeg_thread_seek_start(player->ffmpeg_ctx);
+#else
             av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
                           0, 0, AVSEEK_FLAG_BACKWARD);
+#endif
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player stop");
             break;
         case LV_FFMPEG_PLAYER_CMD_PAUSE:
+#if LV_USE_OS
+            ffmpeg_thread_clock_pause(player->ffmpeg_ctx, true);
+#endif
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player pause");
             break;
         case LV_FFMPEG_PLAYER_CMD_RESUME:
+#if LV_USE_OS
+            ffmpeg_thread_clock_pause(player->ffmpeg_ctx, false);
+#endif
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player resume");
             break;
@@ -301,7 +395,7 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
             return LV_RESULT_INVALID;
         }
 
-        if(ffmpeg_image_allocate(ffmpeg_ctx) < 0) {
+        if(ffmpeg_image_allocate(ffmpeg_ctx) < 0 || ffmpeg_image_allocate_dst(ffmpeg_ctx) < 0) {
             LV_LOG_ERROR("ffmpeg image allocate failed");
             ffmpeg_close(ffmpeg_ctx);
             return LV_RESULT_INVALID;
@@ -407,12 +501,21 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
 
-    /* copy decoded frame to destination buffer:
-     * this is required since rawvideo expects non aligned data
-     */
-    av_image_copy(ffmpeg_ctx->video_src_data, ffmpeg_ctx->video_src_linesize,
-                  (const uint8_t **)(frame->data), frame->linesize,
-                  ffmpeg_ctx->video_dec_ctx->pix_fmt, width, height);
+    if(frame->best_effort_timestamp != AV_NOPTS_VALUE) {
+        AVRational ms_time_base = {1, 1000};
+        ffmpeg_ctx->frame_pts = av_rescale_q(frame->best_effort_timestamp, ffmpeg_ctx->video_stream->time_base,
+                                             ms_time_base);
+    }
+    else {
+        int period = ffmpeg_get_frame_refr_period(ffmpeg_ctx);
+        ffmpeg_ctx->frame_pts += period > 0 ? period : FRAME_DEF_REFR_PERIOD;
+    }
+
+    /* The conversion is the most expensive part, so skip it if the frame would be dropped anyway */
+    if(ffmpeg_ctx->frame_pts < ffmpeg_ctx->drop_before_pts) {
+        ffmpeg_ctx->frame_dropped = true;
+        return 0;
+    }
 
     if(ffmpeg_ctx->sws_ctx == NULL) {
         int swsFlags = SWS_BILINEAR;
@@ -453,15 +556,18 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
         }
     }
 
+    /* Convert directly from the decoder's frame to the destination buffer */
     ret = sws_scale(
               ffmpeg_ctx->sws_ctx,
-              (const uint8_t * const *)(ffmpeg_ctx->video_src_data),
-              ffmpeg_ctx->video_src_linesize,
+              (const uint8_t * const *)(frame->data),
+              frame->linesize,
               0,
               height,
               ffmpeg_ctx->video_dst_data,
               ffmpeg_ctx->video_dst_linesize);
 
+    if(ret >= 0) ffmpeg_ctx->frame_ready = true;
+
 failed:
     return ret;
 }
@@ -735,6 +841,8 @@ static struct ffmpeg_context_s * ffmpeg_open_file(const char * path, bool is_lv_
         goto failed;
     }
 
+    ffmpeg_ctx->drop_before_pts = INT64_MIN;
+
     if(is_lv_fs_path) {
         lv_fs_open(&(ffmpeg_ctx->lv_file), path, LV_FS_MODE_RD);    /* image_decoder_get_info says the file truly exists. */
 
@@ -799,39 +907,6 @@ failed:
 
 static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
 {
-    int ret;
-
-    /* allocate image where the decoded image will be put */
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_src_data,
-              ffmpeg_ctx->video_src_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dec_ctx->pix_fmt,
-              4);
-
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate src raw video buffer");
-        return ret;
-    }
-
-    LV_LOG_INFO("alloc video_src_bufsize = %d", ret);
-
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_dst_data,
-              ffmpeg_ctx->video_dst_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dst_pix_fmt,
-              4);
-
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate dst raw video buffer");
-        return ret;
-    }
-
-    LV_LOG_INFO("allocate video_dst_bufsize = %d", ret);
-
     ffmpeg_ctx->frame = av_frame_alloc();
 
     if(ffmpeg_ctx->frame == NULL) {
@@ -852,23 +927,44 @@ static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
     return 0;
 }
 
+static int ffmpeg_image_allocate_dst(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    /* allocate image where the converted image will be put */
+    int ret = av_image_alloc(
+                  ffmpeg_ctx->video_dst_data,
+                  ffmpeg_ctx->video_dst_linesize,
+                  ffmpeg_ctx->video_dec_ctx->width,
+                  ffmpeg_ctx->video_dec_ctx->height,
+                  ffmpeg_ctx->video_dst_pix_fmt,
+                  4);
+
+    if(ret < 0) {
+        LV_LOG_ERROR("Could not allocate dst raw video buffer");
+        return ret;
+    }
+
+    ffmpeg_ctx->dst_allocated = true;
+    LV_LOG_INFO("allocate video_dst_bufsize = %d", ret);
+
+    return 0;
+}
+
 static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     avcodec_free_context(&(ffmpeg_ctx->video_dec_ctx));
     avformat_close_input(&(ffmpeg_ctx->fmt_ctx));
     av_frame_free(&(ffmpeg_ctx->frame));
-    if(ffmpeg_ctx->video_src_data[0] != NULL) {
-        av_free(ffmpeg_ctx->video_src_data[0]);
-        ffmpeg_ctx->video_src_data[0] = NULL;
-    }
+    av_packet_free(&(ffmpeg_ctx->pkt));
 }
 
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
 {
-    if(ffmpeg_ctx->video_dst_data[0] != NULL) {
+    /*The frame buffers of the decoding thread are freed when the thread stops*/
+    if(ffmpeg_ctx->dst_allocated) {
         av_free(ffmpeg_ctx->video_dst_data[0]);
-        ffmpeg_ctx->video_dst_data[0] = NULL;
+        ffmpeg_ctx->dst_allocated = false;
     }
+    ffmpeg_ctx->video_dst_data[0] = NULL;
 }
 
 static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
@@ -878,6 +974,10 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
         return;
     }
 
+#if LV_USE_OS
+    ffmpeg_thread_stop(ffmpeg_ctx);
+#endif
+
     sws_freeContext(ffmpeg_ctx->sws_ctx);
     ffmpeg_close_src_ctx(ffmpeg_ctx);
     ffmpeg_close_dst_ctx(ffmpeg_ctx);
@@ -891,6 +991,266 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
     LV_LOG_INFO("ffmpeg_ctx closed");
 }
 
+#if LV_USE_OS
+
+static lv_result_t ffmpeg_thread_start(struct ffmpeg_context_s * ffmpeg_ctx, lv_color_format_t cf, uint32_t stride)
+{
+    int width = ffmpeg_ctx->video_dec_ctx->width;
+    int height = ffmpeg_ctx->video_dec_ctx->height;
+
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        lv_draw_buf_t * draw_buf = lv_draw_buf_create(width, height, cf, stride);
+        if(draw_buf == NULL) {
+            LV_LOG_ERROR("Could not allocate frame buffer");
+            ffmpeg_thread_stop(ffmpeg_ctx);
+            return LV_RESULT_INVALID;
+        }
+
+        ffmpeg_ctx->frames[i].draw_buf = draw_buf;
+        ffmpeg_ctx->frames[i].state = FRAME_STATE_FREE;
+    }
+
+    /*Show an empty frame until the first one is decoded*/
+    lv_draw_buf_clear(ffmpeg_ctx->frames[0].draw_buf, NULL);
+    ffmpeg_ctx->frames[0].state = FRAME_STATE_SHOWN;
+    ffmpeg_ctx->late_pts = INT64_MIN;
+
+    lv_mutex_init(&ffmpeg_ctx->lock);
+    lv_thread_sync_init(&ffmpeg_ctx->sync);
+    if(lv_thread_init(&ffmpeg_ctx->thread, LV_THREAD_PRIO_MID, ffmpeg_decode_thread_cb, DECODE_THREAD_STACK_SIZE,
+                      ffmpeg_ctx) != LV_RESULT_OK) {
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_mutex_delete(&ffmpeg_ctx->lock);
+        ffmpeg_thread_stop(ffmpeg_ctx);
+        return LV_RESULT_INVALID;
+    }
+
+    ffmpeg_ctx->thread_running = true;
+    return LV_RESULT_OK;
+}
+
+static void ffmpeg_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(ffmpeg_ctx->thread_running) {
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        ffmpeg_ctx->thread_exit = true;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        lv_thread_delete(&ffmpeg_ctx->thread);
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_mutex_delete(&ffmpeg_ctx->lock);
+        ffmpeg_ctx->thread_running = false;
+    }
+
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        if(ffmpeg_ctx->frames[i].draw_buf) {
+            lv_draw_buf_destroy(ffmpeg_ctx->frames[i].draw_buf);
+            ffmpeg_ctx->frames[i].draw_buf = NULL;
+        }
+    }
+}
+
+/**
+ * Rewind to the beginning of the video. The frames which are already decoded are dropped.
+ */
+static void ffmpeg_thread_seek_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->seek_gen++;
+    ffmpeg_ctx->eof = false;
+    ffmpeg_ctx->late_pts = INT64_MIN;
+
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        if(ffmpeg_ctx->frames[i].state == FRAME_STATE_READY) ffmpeg_ctx->frames[i].state = FRAME_STATE_FREE;
+    }
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+    ffmpeg_ctx->clock_valid = false;
+    ffmpeg_ctx->clock_paused = false;
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+}
+
+static int64_t ffmpeg_thread_clock_get(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(ffmpeg_ctx->clock_paused) return ffmpeg_ctx->clock_pts;
+    return ffmpeg_ctx->clock_pts + lv_tick_elaps(ffmpeg_ctx->clock_tick);
+}
+
+static void ffmpeg_thread_clock_pause(struct ffmpeg_context_s * ffmpeg_ctx, bool pause)
+{
+    if(ffmpeg_ctx->clock_paused == pause) return;
+
+    if(pause) ffmpeg_ctx->clock_pts = ffmpeg_thread_clock_get(ffmpeg_ctx);
+    else ffmpeg_ctx->clock_tick = lv_tick_get();
+
+    ffmpeg_ctx->clock_paused = pause;
+}
+
+/**
+ * Decode the next frame and convert it into a frame buffer.
+ * The late frames are not converted, but at least every `FRAME_DROP_MAX`th frame is.
+ * @param ffmpeg_ctx    pointer to the ffmpeg context
+ * @param draw_buf      the frame buffer
+ * @return              >= 0: the frame is ready; < 0: end of the video or error
+ */
+static int ffmpeg_decode_frame(struct ffmpeg_context_s * ffmpeg_ctx, lv_draw_buf_t * draw_buf)
+{
+    ffmpeg_ctx->video_dst_data[0] = draw_buf->data;
+    ffmpeg_ctx->video_dst_linesize[0] = draw_buf->header.stride;
+
+    uint32_t drop_cnt = 0;
+    while(1) {
+        if(drop_cnt >= FRAME_DROP_MAX) ffmpeg_ctx->drop_before_pts = INT64_MIN;
+        ffmpeg_ctx->frame_ready = false;
+        ffmpeg_ctx->frame_dropped = false;
+
+        int ret = ffmpeg_update_next_frame(ffmpeg_ctx);
+        if(ret < 0) return ret;
+        if(ffmpeg_ctx->frame_ready) return 0;
+        if(ffmpeg_ctx->frame_dropped) drop_cnt++;
+    }
+}
+
+static void ffmpeg_decode_thread_cb(void * user_data)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = user_data;
+
+    while(1) {
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        if(ffmpeg_ctx->thread_exit) {
+            lv_mutex_unlock(&ffmpeg_ctx->lock);
+            break;
+        }
+
+        uint32_t seek_gen = ffmpeg_ctx->seek_gen;
+        bool seek = seek_gen != ffmpeg_ctx->thread_seek_gen;
+        ffmpeg_frame_t * frame = NULL;
+        if(!seek && !ffmpeg_ctx->eof) {
+            uint32_t i;
+            for(i = 0; i < FRAME_BUF_CNT; i++) {
+                if(ffmpeg_ctx->frames[i].state == FRAME_STATE_FREE) {
+                    frame = &ffmpeg_ctx->frames[i];
+                    frame->state = FRAME_STATE_DECODING;
+                    break;
+                }
+            }
+        }
+        ffmpeg_ctx->drop_before_pts = ffmpeg_ctx->late_pts;
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+        if(seek) {
+            av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+
+            lv_mutex_lock(&ffmpeg_ctx->lock);
+            ffmpeg_ctx->thread_seek_gen = seek_gen;
+            lv_mutex_unlock(&ffmpeg_ctx->lock);
+            continue;
+        }
+
+        if(frame == NULL) {
+            /*Wait for a free frame buffer, rewinding or exiting*/
+            lv_thread_sync_wait(&ffmpeg_ctx->sync);
+            continue;
+        }
+
+        int ret = ffmpeg_decode_frame(ffmpeg_ctx, frame->draw_buf);
+
+        lv_mutex_lock(&ffmpeg_ctx->lock);
+        if(seek_gen != ffmpeg_ctx->seek_gen) {
+            /*Rewound meanwhile, this frame is not needed anymore*/
+            frame->state = FRAME_STATE_FREE;
+        }
+        else if(ret < 0) {
+            frame->state = FRAME_STATE_FREE;
+            ffmpeg_ctx->eof = true;
+        }
+        else {
+            frame->pts = ffmpeg_ctx->frame_pts;
+            frame->state = FRAME_STATE_READY;
+        }
+        lv_mutex_unlock(&ffmpeg_ctx->lock);
+    }
+}
+
+/**
+ * Show the latest decoded frame whose PTS has been reached and drop the older ones.
+ * The frame buffer is passed to the image directly, without copying it.
+ * @param player    pointer to an ffmpeg player
+ */
+static void ffmpeg_player_show_next_frame(lv_ffmpeg_player_t * player)
+{
+    lv_obj_t * obj = (lv_obj_t *)player;
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    int64_t now = ffmpeg_ctx->clock_valid ? ffmpeg_thread_clock_get(ffmpeg_ctx) : 0;
+
+    lv_mutex_lock(&ffmpeg_ctx->lock);
+
+    ffmpeg_frame_t * next = NULL;
+    bool pending = false;
+    uint32_t i;
+    for(i = 0; i < FRAME_BUF_CNT; i++) {
+        ffmpeg_frame_t * frame = &ffmpeg_ctx->frames[i];
+        if(frame->state == FRAME_STATE_DECODING) pending = true;
+        if(frame->state != FRAME_STATE_READY) continue;
+
+        pending = true;
+        /*Start with the first frame after rewinding*/
+        if(!ffmpeg_ctx->clock_valid) {
+            if(next == NULL || frame->pts < next->pts) next = frame;
+        }
+        else if(frame->pts <= now && (next == NULL || frame->pts > next->pts)) {
+            next = frame;
+        }
+    }
+
+    if(next) {
+        for(i = 0; i < FRAME_BUF_CNT; i++) {
+            ffmpeg_frame_t * frame = &ffmpeg_ctx->frames[i];
+            if(frame->state == FRAME_STATE_SHOWN) frame->state = FRAME_STATE_FREE;
+            else if(frame->state == FRAME_STATE_READY && frame->pts < next->pts) frame->state = FRAME_STATE_FREE;
+        }
+        next->state = FRAME_STATE_SHOWN;
+    }
+
+    bool ended = ffmpeg_ctx->eof && !pending;
+
+    if(ffmpeg_ctx->clock_valid) {
+        /*Let the decoding thread skip the frames which are late by more than a frame*/
+        int period = ffmpeg_get_frame_refr_period(ffmpeg_ctx);
+        ffmpeg_ctx->late_pts = now - (period > 0 ? period : FRAME_DEF_REFR_PERIOD);
+    }
+
+    lv_mutex_unlock(&ffmpeg_ctx->lock);
+
+    if(next) {
+        if(!ffmpeg_ctx->clock_valid) {
+            ffmpeg_ctx->clock_pts = next->pts;
+            ffmpeg_ctx->clock_tick = lv_tick_get();
+            ffmpeg_ctx->clock_valid = true;
+        }
+
+        /*Some frame buffers might be free now*/
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+
+        lv_image_cache_drop(lv_image_get_src(obj));
+        player->imgdsc.data = next->draw_buf->data;
+        lv_obj_invalidate(obj);
+    }
+    else if(ended) {
+        lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+        if(!player->auto_restart) {
+            lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+        }
+    }
+}
+
+#endif /*LV_USE_OS*/
+
 static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 {
     lv_obj_t * obj = (lv_obj_t *)lv_timer_get_user_data(timer);
@@ -900,6 +1260,9 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
         return;
     }
 
+#if LV_USE_OS
+    ffmpeg_player_show_next_frame(player);
+#else
     int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
 
     if(has_next < 0) {
@@ -913,6 +1276,7 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
     lv_image_cache_drop(lv_image_get_src(obj));
 
     lv_obj_invalidate(obj);
+#endif
 }
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p,
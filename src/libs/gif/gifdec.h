@@ -34,6 +34,7 @@ typedef struct _gd_GIF {
     uint16_t width, height;
     uint16_t depth;
     int32_t loop_count;
+    int32_t frame_index;    /*Index of the last read frame in the loop, -1 before the first frame*/
     gd_GCE gce;
     gd_Palette * palette;
     gd_Palette lct, gct;
@@ -9,6 +9,7 @@
 #include "lv_gif_private.h"
 #if LV_USE_GIF
 #include "../../misc/lv_timer_private.h"
+#include "../../misc/lv_area_private.h"
 #include "../../misc/cache/lv_image_cache.h"
 #include "../../core/lv_obj_class_private.h"
 
@@ -29,6 +30,12 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void next_cached_frame(lv_obj_t * obj);
+static void cache_frame(lv_obj_t * obj, const lv_area_t * area);
+static void frames_free(lv_gif_t * gifobj);
+static void frames_reset(lv_obj_t * obj);
+static void get_frame_area(const gd_GIF * gif, lv_area_t * area);
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -68,6 +75,7 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     if(gif != NULL) {
         lv_image_cache_drop(lv_image_get_src(obj));
 
+        frames_reset(obj);
         gd_close_gif(gif);
         gifobj->gif = NULL;
         gifobj->imgdsc.data = NULL;
@@ -115,6 +123,7 @@ void lv_gif_restart(lv_obj_t * obj)
         return;
     }
 
+    frames_reset(obj);
     gd_rewind(gifobj->gif);
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
@@ -168,6 +177,14 @@ void lv_gif_set_loop_count(lv_obj_t * obj, int32_t count)
     gifobj->gif->loop_count = count;
 }
 
+void lv_gif_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    gifobj->frame_cache_size = max_size;
+    frames_reset(obj);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -190,6 +207,7 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     lv_image_cache_drop(lv_image_get_src(obj));
 
+    frames_free(gifobj);
     if(gifobj->gif)
         gd_close_gif(gifobj->gif);
     lv_timer_delete(gifobj->timer);
@@ -199,23 +217,210 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gd_GIF * gif = gifobj->gif;
+
+    if(gifobj->frames_complete) {
+        next_cached_frame(obj);
+        return;
+    }
+
     uint32_t elaps = lv_tick_elaps(gifobj->last_call);
-    if(elaps < gifobj->gif->gce.delay * 10) return;
+    if(elaps < gif->gce.delay * 10) return;
 
     gifobj->last_call = lv_tick_get();
 
-    int has_next = gd_get_frame(gifobj->gif);
+    /*Disposal method 2 restores the area of the previous frame to the background*/
+    bool prev_restored = gif->gce.disposal == 2;
+    lv_area_t prev_area;
+    get_frame_area(gif, &prev_area);
+
+    int has_next = gd_get_frame(gif);
     if(has_next == 0) {
         /*It was the last repeat*/
+        frames_free(gifobj);
         lv_result_t res = lv_obj_send_event(obj, LV_EVENT_READY, NULL);
         lv_timer_pause(t);
         if(res != LV_RESULT_OK) return;
     }
 
-    gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
+    gd_render_frame(gif, (uint8_t *)gifobj->imgdsc.data);
+
+    lv_area_t area;
+    if(has_next < 0) {
+        /*Don't trust the frame's area if the decoding failed*/
+        lv_area_set(&area, 0, 0, gif->width - 1, gif->height - 1);
+    }
+    else {
+        get_frame_area(gif, &area);
+        if(prev_restored) lv_area_join(&area, &area, &prev_area);
+    }
+
+    if(has_next > 0) cache_frame(obj, &area);
 
     lv_image_cache_drop(lv_image_get_src(obj));
-    lv_obj_invalidate(obj);
+    invalidate_frame_area(obj, &area);
+}
+
+static void next_cached_frame(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gd_GIF * gif = gifobj->gif;
+
+    /*`frame_act == frame_cnt` means the last loop has ended*/
+    uint32_t shown = LV_MIN(gifobj->frame_act, gifobj->frame_cnt - 1);
+    uint32_t elaps = lv_tick_elaps(gifobj->last_call);
+    if(elaps < gifobj->frames[shown].delay * 10) return;
+
+    gifobj->last_call = lv_tick_get();
+
+    uint32_t next = gifobj->frame_act + 1;
+    if(gifobj->frame_act == gifobj->frame_cnt) {
+        /*Resumed after the last loop*/
+        next = 0;
+    }
+    else if(next == gifobj->frame_cnt) {
+        /*Count the loops the same way as the decoder does*/
+        if(gif->loop_count == 1 || gif->loop_count < 0) {
+            gifobj->frame_act = gifobj->frame_cnt;
+            lv_timer_pause(gifobj->timer);
+            lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+            return;
+        }
+        if(gif->loop_count > 1) gif->loop_count--;
+        next = 0;
+    }
+
+    gifobj->frame_act = next;
+    gifobj->imgdsc.data = gifobj->frames[next].data;
+
+    lv_image_cache_drop(lv_image_get_src(obj));
+    invalidate_frame_area(obj, &gifobj->frames[next].area);
+}
+
+/**
+ * Save the frame which was just rendered to the canvas. When the loop restarts and the canvas is the same
+ * as the first cached frame, all the next loops will be the same too, so play them from the cache.
+ * @param obj   pointer to a gif obj
+ * @param area  the area of the canvas which changed compared to the previous frame
+ */
+static void cache_frame(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    gd_GIF * gif = gifobj->gif;
+
+    if(gifobj->frame_cache_size == 0 || gifobj->frames_failed) return;
+
+    uint32_t frame_size = gifobj->imgdsc.data_size;
+
+    if(gif->frame_index == 0 && gifobj->frame_cnt > 0) {
+        if(lv_memcmp(gif->canvas, gifobj->frames[0].data, frame_size) == 0) {
+            gifobj->frames[0].area = *area;
+            gifobj->frame_act = 0;
+            gifobj->frames_complete = 1;
+            gifobj->imgdsc.data = gifobj->frames[0].data;
+            return;
+        }
+
+        /*The first loop was drawn on the background but the next ones are drawn on the last frame.
+         *Try again with the second loop.*/
+        frames_free(gifobj);
+        if(gifobj->frames_retried) {
+            gifobj->frames_failed = 1;
+            return;
+        }
+        gifobj->frames_retried = 1;
+    }
+
+    /*Wait for the start of the loop if the caching was enabled during playing*/
+    if(gifobj->frame_cnt == 0 && gif->frame_index != 0) return;
+
+    if(gif->frame_index != (int32_t)gifobj->frame_cnt ||
+       gifobj->frame_cache_size / (gifobj->frame_cnt + 1) < frame_size) {
+        frames_free(gifobj);
+        gifobj->frames_failed = 1;
+        return;
+    }
+
+    uint8_t * data = lv_malloc(frame_size);
+    lv_gif_frame_t * frames = lv_realloc(gifobj->frames, (gifobj->frame_cnt + 1) * sizeof(lv_gif_frame_t));
+    if(data == NULL || frames == NULL) {
+        LV_LOG_WARN("Couldn't allocate memory for the cached frames");
+        lv_free(data);
+        if(frames) gifobj->frames = frames;
+        frames_free(gifobj);
+        gifobj->frames_failed = 1;
+        return;
+    }
+
+    lv_memcpy(data, gif->canvas, frame_size);
+    gifobj->frames = frames;
+    gifobj->frames[gifobj->frame_cnt].data = data;
+    gifobj->frames[gifobj->frame_cnt].area = *area;
+    gifobj->frames[gifobj->frame_cnt].delay = gif->gce.delay;
+    gifobj->frame_cnt++;
+}
+
+static void frames_free(lv_gif_t * gifobj)
+{
+    uint32_t i;
+    for(i = 0; i < gifobj->frame_cnt; i++) {
+        lv_free(gifobj->frames[i].data);
+    }
+    lv_free(gifobj->frames);
+    gifobj->frames = NULL;
+    gifobj->frame_cnt = 0;
+}
+
+/**
+ * Drop the cached frames and continue decoding the GIF.
+ * @param obj   pointer to a gif obj
+ */
+static void frames_reset(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    if(gifobj->frames_complete) {
+        /*The decoder has stopped at the first frame of the loop, so continue from there*/
+        lv_image_cache_drop(lv_image_get_src(obj));
+        gifobj->imgdsc.data = gifobj->gif->canvas;
+        lv_obj_invalidate(obj);
+    }
+
+    frames_free(gifobj);
+    gifobj->frames_complete = 0;
+    gifobj->frames_failed = 0;
+    gifobj->frames_retried = 0;
+}
+
+static void get_frame_area(const gd_GIF * gif, lv_area_t * area)
+{
+    lv_area_set(area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+}
+
+/**
+ * Invalidate only the changed area of the GIF instead of the whole object
+ * @param obj   pointer to a gif obj
+ * @param area  the changed area relative to the GIF's canvas
+ */
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_image_t * img = (lv_image_t *) obj;
+
+    /*It's not trivial where the pixels are drawn if the image is transformed, stretched or tiled*/
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Find the image's position the same way as lv_image does when drawing*/
+    lv_area_t image_area;
+    lv_area_set(&image_area, obj->coords.x1, obj->coords.y1, obj->coords.x1 + img->w - 1, obj->coords.y1 + img->h - 1);
+    lv_area_align(&obj->coords, &image_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t inv_area = *area;
+    lv_area_move(&inv_area, image_area.x1, image_area.y1);
+    lv_obj_invalidate_area(obj, &inv_area);
 }
 
 #endif /*LV_USE_GIF*/
@@ -91,6 +91,15 @@ int32_t lv_gif_get_loop_count(lv_obj_t * obj);
  */
 void lv_gif_set_loop_count(lv_obj_t * obj, int32_t count);
 
+/**
+ * Cache the fully rendered frames of the first loop and play the next loops from the cache
+ * without decoding. The frames are cached only if all of them fit into `max_size` bytes
+ * (`width * height * 4` bytes per frame), so it's useful for short animations.
+ * @param obj       pointer to a gif obj
+ * @param max_size  memory available for the frames in bytes, 0: disable caching (default)
+ */
+void lv_gif_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size);
+
 /**********************
  *      MACROS
  **********************/
@@ -27,9 +27,12 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
-/**********************
- *      TYPEDEFS
- **********************/
+/** A fully rendered frame of a cached GIF loop */
+typedef struct {
+    uint8_t * data;     /**< ARGB8888 pixels of the whole canvas*/
+    lv_area_t area;     /**< The area which changed compared to the previous frame, relative to the canvas*/
+    uint16_t delay;     /**< How long the frame is shown [10 ms]*/
+} lv_gif_frame_t;
 
 struct _lv_gif_t {
     lv_image_t img;
@@ -37,6 +40,13 @@ struct _lv_gif_t {
     lv_timer_t * timer;
     lv_image_dsc_t imgdsc;
     uint32_t last_call;
+    lv_gif_frame_t * frames;        /**< The cached frames of the loop*/
+    uint32_t frame_cnt;             /**< Number of cached frames*/
+    uint32_t frame_act;             /**< Index of the shown frame while playing from the cache*/
+    uint32_t frame_cache_size;      /**< Max. memory to use for the cached frames, 0: caching is disabled*/
+    uint32_t frames_complete : 1;   /**< All frames of the loop are cached, so play them from the cache*/
+    uint32_t frames_failed : 1;     /**< The loop can't be cached (it's too large or the loops differ)*/
+    uint32_t frames_retried : 1;    /**< The first loop differed from the next ones and the caching was restarted*/
 };
 
 
@@ -27,6 +27,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_X86_SIMD     3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -227,6 +228,18 @@
             #endif
         #endif
     #endif
+
+    /** Keep the freed small blocks (<= 256 bytes) in per-thread caches of size classes, so that
+     *  most `lv_malloc()`/`lv_free()` calls of small objects (draw tasks, descriptors, list nodes)
+     *  don't need to lock the heap. The maximum number of cached blocks per size class and thread.
+     *  0: disable. Only `LV_OS_NONE`, `LV_OS_PTHREAD` and `LV_OS_WINDOWS` are supported. */
+    #ifndef LV_MEM_THREAD_CACHE
+        #ifdef CONFIG_LV_MEM_THREAD_CACHE
+            #define LV_MEM_THREAD_CACHE CONFIG_LV_MEM_THREAD_CACHE
+        #else
+            #define LV_MEM_THREAD_CACHE 0
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -252,6 +265,29 @@
     #endif
 #endif
 
+/** Maximum number of separately refreshed areas of a display.
+ *  The buffer of the invalidated areas grows on demand up to this limit. Above it the new areas
+ *  are merged with the saved area which increases the refreshed area the least. */
+#ifndef LV_INV_AREA_MAX_CNT
+    #ifdef CONFIG_LV_INV_AREA_MAX_CNT
+        #define LV_INV_AREA_MAX_CNT CONFIG_LV_INV_AREA_MAX_CNT
+    #else
+        #define LV_INV_AREA_MAX_CNT 256
+    #endif
+#endif
+
+/** Cost of refreshing and flushing an area separately, expressed in pixels.
+ *  Two invalidated areas are merged if their bounding box is smaller than their total size plus this cost.
+ *  Larger values mean fewer but larger areas to flush.
+ *  - 0: merge only if fewer pixels need to be refreshed */
+#ifndef LV_INV_AREA_MERGE_COST
+    #ifdef CONFIG_LV_INV_AREA_MERGE_COST
+        #define LV_INV_AREA_MERGE_COST CONFIG_LV_INV_AREA_MERGE_COST
+    #else
+        #define LV_INV_AREA_MERGE_COST 0    /**< [px] */
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -363,6 +399,31 @@
     #endif
 #endif
 
+/** Tile size of the per-layer index of the draw tasks.
+ *  With more than one draw unit the unfinished draw tasks are bucketed into tiles of this size
+ *  so that the independent draw tasks can be found without checking all the older ones.
+ *  - 0: disable the index and check all the older draw tasks */
+#ifndef LV_DRAW_TASK_INDEX_TILE_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_INDEX_TILE_SIZE
+        #define LV_DRAW_TASK_INDEX_TILE_SIZE CONFIG_LV_DRAW_TASK_INDEX_TILE_SIZE
+    #else
+        #define LV_DRAW_TASK_INDEX_TILE_SIZE    64              /**< [px]*/
+    #endif
+#endif
+
+/** Size of the chunks of the arena holding the draw tasks and their draw descriptors.
+ *  Instead of allocating them one by one on the heap they are taken from a bump allocator
+ *  whose chunk is reset in one step when all of its draw tasks are finished.
+ *  It should be large enough for the draw tasks of a typical frame.
+ *  - 0: allocate every draw task and descriptor with `lv_malloc()` */
+#ifndef LV_DRAW_TASK_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_ARENA_SIZE
+        #define LV_DRAW_TASK_ARENA_SIZE CONFIG_LV_DRAW_TASK_ARENA_SIZE
+    #else
+        #define LV_DRAW_TASK_ARENA_SIZE         0               /**< [bytes]*/
+    #endif
+#endif
+
 #ifndef LV_USE_DRAW_SW
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_DRAW_SW
@@ -480,6 +541,17 @@
             #define LV_DRAW_SW_SUPPORT_I1           1
         #endif
     #endif
+    #ifndef LV_DRAW_SW_SUPPORT_YUV
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_DRAW_SW_SUPPORT_YUV
+                #define LV_DRAW_SW_SUPPORT_YUV CONFIG_LV_DRAW_SW_SUPPORT_YUV
+            #else
+                #define LV_DRAW_SW_SUPPORT_YUV 0
+            #endif
+        #else
+            #define LV_DRAW_SW_SUPPORT_YUV          1   /**< I420, I422, I444, I400, NV12, NV21, YUY2 and UYVY images*/
+        #endif
+    #endif
 
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
@@ -496,6 +568,20 @@
         #endif
     #endif
 
+    /** Split large fill, image and layer blending draw tasks into horizontal bands.
+     *  Idle draw units can steal the bands of the others, so a single large draw task
+     *  is rendered by all the draw units in parallel.
+     *  - > 0 requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`.
+     *  - Draw tasks covering at least this many pixels are split.
+     *  - 0: disable splitting */
+    #ifndef LV_DRAW_SW_BAND_SPLIT_MIN_AREA
+        #ifdef CONFIG_LV_DRAW_SW_BAND_SPLIT_MIN_AREA
+            #define LV_DRAW_SW_BAND_SPLIT_MIN_AREA CONFIG_LV_DRAW_SW_BAND_SPLIT_MIN_AREA
+        #else
+            #define LV_DRAW_SW_BAND_SPLIT_MIN_AREA  0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -554,6 +640,12 @@
         #endif
     #endif
 
+    /** Use SIMD accelerated blending.
+     *  - LV_DRAW_SW_ASM_NONE:     Use only the C implementation
+     *  - LV_DRAW_SW_ASM_NEON:     Arm Neon
+     *  - LV_DRAW_SW_ASM_HELIUM:   Arm Helium
+     *  - LV_DRAW_SW_ASM_X86_SIMD: SSE2/AVX2 on x86 and x86_64. The instruction set is selected with CPUID in run time.
+     *  - LV_DRAW_SW_ASM_CUSTOM:   Include `LV_DRAW_SW_ASM_CUSTOM_INCLUDE` */
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -1235,6 +1327,17 @@
     #endif
 #endif
 
+/** Cache the resolved style properties of an object for this many part + state combinations
+ *  to get the style properties without checking all the styles of the object.
+ *  Uses about (50 + 9 x number of set properties) bytes per combination. 0: disable */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE 0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1761,6 +1864,29 @@
     #endif
 #endif
 
+/** Number of recently used characters whose glyph index is cached for `lv_font_fmt_txt` fonts
+ *  (built-in, converted and BIN fonts). It speeds up fonts with a lot of characters, e.g. CJK fonts.
+ *  Each entry needs 16 bytes (24 bytes with 64 bit pointers). 0: disable the cache.
+ *  With an OS the cache needs the atomic builtins of GCC or Clang. */
+#ifndef LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Size of the cache of rendered glyphs of `lv_font_fmt_txt` fonts in bytes.
+ *  The glyphs are stored as A8 bitmaps and shared by all draw units. So 1 and 4 bpp glyphs are not
+ *  converted and compressed glyphs are not decompressed on every draw. 0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2379,6 +2505,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_VIRTUALLIST
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_VIRTUALLIST
+            #define LV_USE_VIRTUALLIST CONFIG_LV_USE_VIRTUALLIST
+        #else
+            #define LV_USE_VIRTUALLIST 0
+        #endif
+    #else
+        #define LV_USE_VIRTUALLIST 1
+    #endif
+#endif
+
 #ifndef LV_USE_WIN
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_WIN
@@ -3081,6 +3219,17 @@
             #endif
         #endif
     #endif
+
+    /** Number of per-frame timing records to keep for each display. 0: disable.
+     *  Read them with `lv_sysmon_get_frame_stats()`.
+     *  - Requires `LV_USE_SYSMON = 1` */
+    #ifndef LV_SYSMON_FRAME_STATS_CNT
+        #ifdef CONFIG_LV_SYSMON_FRAME_STATS_CNT
+            #define LV_SYSMON_FRAME_STATS_CNT CONFIG_LV_SYSMON_FRAME_STATS_CNT
+        #else
+            #define LV_SYSMON_FRAME_STATS_CNT 0
+        #endif
+    #endif
 #endif /*LV_USE_SYSMON*/
 
 /** 1: Enable runtime performance profiler */
@@ -3644,6 +3793,15 @@
             #define LV_LINUX_FBDEV_BUFFER_SIZE   60
         #endif
     #endif
+    /** Render directly into the framebuffer using its two halves as buffers and pan between them.
+     *  Requires DIRECT or FULL render mode, the draw buffers above are not allocated then. */
+    #ifndef LV_LINUX_FBDEV_USE_PANNING
+        #ifdef CONFIG_LV_LINUX_FBDEV_USE_PANNING
+            #define LV_LINUX_FBDEV_USE_PANNING CONFIG_LV_LINUX_FBDEV_USE_PANNING
+        #else
+            #define LV_LINUX_FBDEV_USE_PANNING   0
+        #endif
+    #endif
 #endif
 
 /** Use Nuttx to open window and handle touchscreen */
@@ -3733,6 +3891,18 @@
         #define LV_USE_LINUX_DRM        0
     #endif
 #endif
+#if LV_USE_LINUX_DRM
+    /** Number of DUMB buffers.
+     *  - 2: Rendering waits until the page flip of the previous frame is done.
+     *  - 3: Render the next frame into the third buffer while the page flip is pending. */
+    #ifndef LV_LINUX_DRM_BUFFER_COUNT
+        #ifdef CONFIG_LV_LINUX_DRM_BUFFER_COUNT
+            #define LV_LINUX_DRM_BUFFER_COUNT CONFIG_LV_LINUX_DRM_BUFFER_COUNT
+        #else
+            #define LV_LINUX_DRM_BUFFER_COUNT   2
+        #endif
+    #endif
+#endif
 
 /** Interface for TFT_eSPI */
 #ifndef LV_USE_TFT_ESPI
@@ -4115,6 +4285,7 @@ LV_EXPORT_CONST_INT(LV_DRAW_BUF_ALIGN);
 #if LV_USE_SYSMON == 0
     #define LV_USE_PERF_MONITOR 0
     #define LV_USE_MEM_MONITOR 0
+    #define LV_SYSMON_FRAME_STATS_CNT 0
 #endif /*LV_USE_SYSMON*/
 
 #ifndef LV_USE_LZ4
@@ -10,6 +10,7 @@
 #include "misc/lv_timer_private.h"
 #include "misc/lv_profiler_builtin_private.h"
 #include "misc/lv_anim_private.h"
+#include "font/lv_font_fmt_txt_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
@@ -255,6 +256,10 @@ void lv_init(void)
     lv_sysmon_builtin_init();
 #endif
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_font_fmt_txt_glyph_cache_init();
+#endif
+
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
@@ -404,6 +409,10 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_font_fmt_txt_glyph_cache_deinit();
+#endif
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
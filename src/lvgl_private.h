@@ -90,6 +90,7 @@ extern "C" {
 #include "widgets/led/lv_led_private.h"
 #include "widgets/arc/lv_arc_private.h"
 #include "widgets/tileview/lv_tileview_private.h"
+#include "widgets/virtuallist/lv_virtuallist_private.h"
 #include "widgets/spinbox/lv_spinbox_private.h"
 #include "widgets/span/lv_span_private.h"
 #include "widgets/label/lv_label_private.h"
@@ -164,6 +164,17 @@ void lv_profiler_builtin_set_enable(bool enable)
     profiler_ctx->enable = enable;
 }
 
+uint32_t lv_profiler_builtin_get_tick(uint32_t * tick_per_sec)
+{
+    if(!profiler_ctx) {
+        if(tick_per_sec) *tick_per_sec = 1000;
+        return lv_tick_get();
+    }
+
+    if(tick_per_sec) *tick_per_sec = profiler_ctx->config.tick_per_sec;
+    return profiler_ctx->config.tick_get_cb();
+}
+
 void lv_profiler_builtin_flush(void)
 {
     LV_ASSERT_NULL(profiler_ctx);
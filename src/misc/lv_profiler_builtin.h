@@ -60,6 +60,13 @@ void lv_profiler_builtin_uninit(void);
  */
 void lv_profiler_builtin_set_enable(bool enable);
 
+/**
+ * @brief Get the current tick from the tick source of the built-in profiler
+ * @param tick_per_sec Store the number of ticks per second here (can be NULL)
+ * @return The current tick, or `lv_tick_get()` if the built-in profiler is not initialized
+ */
+uint32_t lv_profiler_builtin_get_tick(uint32_t * tick_per_sec);
+
 /**
  * @brief Flush the profiling data to the console
  */
@@ -20,6 +20,13 @@
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The style might be used by any object, so all the resolved style properties are outdated*/
+    #define STYLE_CHANGED() LV_GLOBAL_DEFAULT()->style_resolved_gen++
+#else
+    #define STYLE_CHANGED()
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -191,8 +198,9 @@ void lv_style_reset(lv_style_t * style)
 {
     LV_ASSERT_STYLE(style);
 
-    if(style->prop_cnt != 255) lv_free(style->values_and_props);
+    if(!lv_style_is_const(style)) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
+    STYLE_CHANGED();
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
@@ -283,6 +291,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+            STYLE_CHANGED();
             LV_PROFILER_STYLE_END;
             return true;
         }
@@ -303,6 +312,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
 
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
     LV_PROFILER_STYLE_BEGIN;
+    STYLE_CHANGED();
     lv_style_prop_t * props;
     int32_t i;
 
@@ -318,6 +328,13 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
         }
     }
 
+    /*254 and 255 mark the frozen and the constant styles*/
+    if(style->prop_cnt >= LV_STYLE_PROP_CNT_MAX) {
+        LV_ASSERT_MSG(false, "Too many properties in a style");
+        LV_PROFILER_STYLE_END;
+        return;
+    }
+
     size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
     if(values_and_props == NULL) {
@@ -47,6 +47,8 @@ extern "C" {
 #define LV_SCALE_NONE            256        /**< Value for not zooming the image */
 LV_EXPORT_CONST_INT(LV_SCALE_NONE);
 
+#define LV_STYLE_PROP_CNT_MAX    253        /**< Max. number of properties in a non-constant style */
+
 // *INDENT-OFF*
 #if LV_USE_ASSERT_STYLE
 #define LV_STYLE_CONST_INIT(var_name, prop_array)                       \
@@ -68,6 +70,122 @@ LV_EXPORT_CONST_INT(LV_SCALE_NONE);
 
 #define LV_STYLE_CONST_PROPS_END { .prop = LV_STYLE_PROP_INV, .value = { .num = 0 } }
 
+/**
+ * Create a frozen constant style. The properties are sorted by their ID at compile time and
+ * a bitmap tells which properties are set, so a property is found (or skipped) without
+ * scanning the list. `prop_list` is a macro listing the properties (without the `LV_STYLE_`
+ * prefix) like this:
+ * @code
+ * #define MY_STYLE_PROPS(PROP, ctx)                            \
+ *     PROP(ctx, BG_COLOR, LV_COLOR_MAKE(0x21, 0x96, 0xf3))     \
+ *     PROP(ctx, RADIUS, 8)
+ *
+ * LV_STYLE_CONST_FROZEN_INIT(my_style, MY_STYLE_PROPS);
+ * @endcode
+ * @note Each property can be listed only once and only built-in properties can be used.
+ * @note It defines some helper constants and static variables too, so it can be used only in
+ *       file scope and without `static`.
+ */
+#define LV_STYLE_CONST_FROZEN_INIT(var_name, prop_list)                                             \
+    enum {                                                                                          \
+        var_name##_frozen_w0 = 0 prop_list(LV_STYLE_FROZEN_BIT, 0),                                \
+        var_name##_frozen_w1 = 0 prop_list(LV_STYLE_FROZEN_BIT, 1),                                \
+        var_name##_frozen_w2 = 0 prop_list(LV_STYLE_FROZEN_BIT, 2),                                \
+        var_name##_frozen_w3 = 0 prop_list(LV_STYLE_FROZEN_BIT, 3),                                \
+        var_name##_frozen_w4 = 0 prop_list(LV_STYLE_FROZEN_BIT, 4),                                \
+        var_name##_frozen_w5 = 0 prop_list(LV_STYLE_FROZEN_BIT, 5),                                \
+        var_name##_frozen_w6 = 0 prop_list(LV_STYLE_FROZEN_BIT, 6),                                \
+        var_name##_frozen_w7 = 0 prop_list(LV_STYLE_FROZEN_BIT, 7),                                \
+        var_name##_frozen_w8 = 0 prop_list(LV_STYLE_FROZEN_BIT, 8),                                \
+        var_name##_frozen_w9 = 0 prop_list(LV_STYLE_FROZEN_BIT, 9),                                \
+        var_name##_frozen_w10 = 0 prop_list(LV_STYLE_FROZEN_BIT, 10),                              \
+        var_name##_frozen_w11 = 0 prop_list(LV_STYLE_FROZEN_BIT, 11),                              \
+        var_name##_frozen_w12 = 0 prop_list(LV_STYLE_FROZEN_BIT, 12),                              \
+        var_name##_frozen_w13 = 0 prop_list(LV_STYLE_FROZEN_BIT, 13),                              \
+        var_name##_frozen_w14 = 0 prop_list(LV_STYLE_FROZEN_BIT, 14),                              \
+        var_name##_frozen_w15 = 0 prop_list(LV_STYLE_FROZEN_BIT, 15),                              \
+        var_name##_frozen_c0 = 0,                                                                   \
+        var_name##_frozen_c1 = var_name##_frozen_c0 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w0),     \
+        var_name##_frozen_c2 = var_name##_frozen_c1 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w1),     \
+        var_name##_frozen_c3 = var_name##_frozen_c2 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w2),     \
+        var_name##_frozen_c4 = var_name##_frozen_c3 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w3),     \
+        var_name##_frozen_c5 = var_name##_frozen_c4 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w4),     \
+        var_name##_frozen_c6 = var_name##_frozen_c5 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w5),     \
+        var_name##_frozen_c7 = var_name##_frozen_c6 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w6),     \
+        var_name##_frozen_c8 = var_name##_frozen_c7 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w7),     \
+        var_name##_frozen_c9 = var_name##_frozen_c8 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w8),     \
+        var_name##_frozen_c10 = var_name##_frozen_c9 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w9),    \
+        var_name##_frozen_c11 = var_name##_frozen_c10 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w10),  \
+        var_name##_frozen_c12 = var_name##_frozen_c11 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w11),  \
+        var_name##_frozen_c13 = var_name##_frozen_c12 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w12),  \
+        var_name##_frozen_c14 = var_name##_frozen_c13 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w13),  \
+        var_name##_frozen_c15 = var_name##_frozen_c14 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w14),  \
+        var_name##_frozen_cnt = var_name##_frozen_c15 + LV_STYLE_FROZEN_POPCNT16(var_name##_frozen_w15)   \
+    };                                                                                              \
+    static const lv_style_const_prop_t var_name##_frozen_props[var_name##_frozen_cnt + 1] = {       \
+        prop_list(LV_STYLE_FROZEN_PROP, var_name)                                                   \
+        [var_name##_frozen_cnt] = LV_STYLE_CONST_PROPS_END                                          \
+    };                                                                                              \
+    static const lv_style_frozen_t var_name##_frozen = {                                            \
+        .prop_is_set = {                                                                            \
+            LV_STYLE_FROZEN_WORD32(var_name, 0, 1), LV_STYLE_FROZEN_WORD32(var_name, 2, 3),         \
+            LV_STYLE_FROZEN_WORD32(var_name, 4, 5), LV_STYLE_FROZEN_WORD32(var_name, 6, 7),         \
+            LV_STYLE_FROZEN_WORD32(var_name, 8, 9), LV_STYLE_FROZEN_WORD32(var_name, 10, 11),       \
+            LV_STYLE_FROZEN_WORD32(var_name, 12, 13), LV_STYLE_FROZEN_WORD32(var_name, 14, 15)      \
+        },                                                                                          \
+        .rank = {                                                                                   \
+            var_name##_frozen_c0, var_name##_frozen_c2, var_name##_frozen_c4, var_name##_frozen_c6,     \
+            var_name##_frozen_c8, var_name##_frozen_c10, var_name##_frozen_c12, var_name##_frozen_c14  \
+        },                                                                                          \
+        .props = var_name##_frozen_props                                                            \
+    };                                                                                              \
+    const lv_style_t var_name = {                                                                   \
+        LV_STYLE_FROZEN_SENTINEL                                                                    \
+        .values_and_props = (void *)&var_name##_frozen,                                             \
+        .has_group = 0 prop_list(LV_STYLE_FROZEN_GROUP, 0),                                         \
+        .prop_cnt = 254                                                                             \
+    }
+
+/*Helpers of LV_STYLE_CONST_FROZEN_INIT. The bitmap is built from 16 bit words as the
+ *enum constants are `int`s*/
+#define LV_STYLE_FROZEN_BIT(word, name, ...)                                                        \
+    | (((LV_STYLE_##name) >> 4) == (word) ? 1 << ((LV_STYLE_##name) & 0xF) : 0)
+
+#define LV_STYLE_FROZEN_GROUP(unused, name, ...)                                                    \
+    | ((uint32_t)1 << (((LV_STYLE_##name) >> 2) > 30 ? 31 : ((LV_STYLE_##name) >> 2)))
+
+#define LV_STYLE_FROZEN_PROP(var_name, name, ...)                                                   \
+    [LV_STYLE_FROZEN_RANK(var_name, LV_STYLE_##name)] = LV_STYLE_CONST_##name(__VA_ARGS__),
+
+#define LV_STYLE_FROZEN_WORD32(var_name, lo, hi)                                                    \
+    ((uint32_t)var_name##_frozen_w##lo | ((uint32_t)var_name##_frozen_w##hi << 16))
+
+/*Number of set properties with lower ID than `prop`*/
+#define LV_STYLE_FROZEN_RANK(var_name, prop)                                                        \
+    (LV_STYLE_FROZEN_SELECT(var_name, c, (prop) >> 4) +                                             \
+     LV_STYLE_FROZEN_POPCNT16(LV_STYLE_FROZEN_SELECT(var_name, w, (prop) >> 4) & ((1 << ((prop) & 0xF)) - 1)))
+
+#define LV_STYLE_FROZEN_SELECT(var_name, x, i)                                                      \
+    ((i) == 0 ? var_name##_frozen_##x##0 : (i) == 1 ? var_name##_frozen_##x##1 :                    \
+     (i) == 2 ? var_name##_frozen_##x##2 : (i) == 3 ? var_name##_frozen_##x##3 :                    \
+     (i) == 4 ? var_name##_frozen_##x##4 : (i) == 5 ? var_name##_frozen_##x##5 :                    \
+     (i) == 6 ? var_name##_frozen_##x##6 : (i) == 7 ? var_name##_frozen_##x##7 :                    \
+     (i) == 8 ? var_name##_frozen_##x##8 : (i) == 9 ? var_name##_frozen_##x##9 :                    \
+     (i) == 10 ? var_name##_frozen_##x##10 : (i) == 11 ? var_name##_frozen_##x##11 :                \
+     (i) == 12 ? var_name##_frozen_##x##12 : (i) == 13 ? var_name##_frozen_##x##13 :                \
+     (i) == 14 ? var_name##_frozen_##x##14 : var_name##_frozen_##x##15)
+
+#define LV_STYLE_FROZEN_POPCNT16(x)     LV_STYLE_FROZEN_POPCNT16_4(LV_STYLE_FROZEN_POPCNT16_2(LV_STYLE_FROZEN_POPCNT16_1(x)))
+#define LV_STYLE_FROZEN_POPCNT16_1(x)   ((x) - (((x) >> 1) & 0x5555))
+#define LV_STYLE_FROZEN_POPCNT16_2(x)   (((x) & 0x3333) + (((x) >> 2) & 0x3333))
+#define LV_STYLE_FROZEN_POPCNT16_4(x)   (((((x) + ((x) >> 4)) & 0x0F0F) * 0x0101 >> 8) & 0x1F)
+
+#if LV_USE_ASSERT_STYLE
+#define LV_STYLE_FROZEN_SENTINEL        .sentinel = LV_STYLE_SENTINEL_VALUE,
+#else
+#define LV_STYLE_FROZEN_SENTINEL
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -364,6 +482,15 @@ typedef struct {
     lv_style_value_t value;
 } lv_style_const_prop_t;
 
+/**
+ * Index of a frozen constant style created by `LV_STYLE_CONST_FROZEN_INIT`.
+ */
+typedef struct {
+    uint32_t prop_is_set[8];                /**< One bit for each property ID*/
+    uint8_t rank[8];                        /**< Number of properties before each word of `prop_is_set`*/
+    const lv_style_const_prop_t * props;    /**< The properties sorted by ID and closed by `LV_STYLE_CONST_PROPS_END`*/
+} lv_style_frozen_t;
+
 /**
  * Descriptor of a style (a collection of properties and values).
  */
@@ -376,7 +503,8 @@ typedef struct {
     void * values_and_props;
 
     uint32_t has_group;
-    uint8_t prop_cnt;   /**< 255 means it's a constant style*/
+    uint8_t prop_cnt;   /**< 255 means it's a constant style, 254 a frozen constant style.
+                         *   Other styles can have at most `LV_STYLE_PROP_CNT_MAX` properties*/
 } lv_style_t;
 
 /**********************
@@ -405,10 +533,31 @@ void lv_style_reset(lv_style_t * style);
  */
 static inline bool lv_style_is_const(const lv_style_t * style)
 {
-    if(style->prop_cnt == 255) return true;
+    if(style->prop_cnt >= 254) return true;
     return false;
 }
 
+/**
+ * Check if a style is a frozen constant style created by `LV_STYLE_CONST_FROZEN_INIT`
+ * @param style     pointer to a style
+ * @return          true: the style is frozen
+ */
+static inline bool lv_style_is_frozen(const lv_style_t * style)
+{
+    return style->prop_cnt == 254;
+}
+
+/**
+ * Get the properties of a constant style
+ * @param style     pointer to a constant style
+ * @return          the properties closed by `LV_STYLE_CONST_PROPS_END`
+ */
+static inline const lv_style_const_prop_t * lv_style_get_const_props(const lv_style_t * style)
+{
+    if(lv_style_is_frozen(style)) return ((const lv_style_frozen_t *)style->values_and_props)->props;
+    return (const lv_style_const_prop_t *)style->values_and_props;
+}
+
 /**
  * Register a new style property for custom usage
  * @return a new property ID, or LV_STYLE_PROP_INV if there are no more available.
@@ -500,7 +649,25 @@ lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style, lv_style_prop_t prop,
                                                        lv_style_value_t * value)
 {
-    if(lv_style_is_const(style)) {
+    if(lv_style_is_frozen(style)) {
+        const lv_style_frozen_t * frozen = (const lv_style_frozen_t *)style->values_and_props;
+        uint32_t word = frozen->prop_is_set[prop >> 5];
+        uint32_t bit = (uint32_t)1 << (prop & 0x1F);
+        if((word & bit) == 0) return LV_STYLE_RES_NOT_FOUND;
+
+        /*The properties are sorted so the index is the number of set bits before this one*/
+        word &= bit - 1;
+#if defined(__GNUC__) || defined(__clang__)
+        uint32_t index = frozen->rank[prop >> 5] + (uint32_t)__builtin_popcount(word);
+#else
+        word = word - ((word >> 1) & 0x55555555);
+        word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+        uint32_t index = frozen->rank[prop >> 5] + ((((word + (word >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+        *value = frozen->props[index].value;
+        return LV_STYLE_RES_FOUND;
+    }
+    else if(lv_style_is_const(style)) {
         lv_style_const_prop_t * props = (lv_style_const_prop_t *)style->values_and_props;
         uint32_t i;
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
@@ -134,573 +134,573 @@ void lv_style_set_grid_cell_row_span(lv_style_t * style, int32_t value);
 #endif /*LV_USE_GRID*/
 
 
-#define LV_STYLE_CONST_WIDTH(val) \
+#define LV_STYLE_CONST_WIDTH(...) \
     { \
-        .prop = LV_STYLE_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MIN_WIDTH(val) \
+#define LV_STYLE_CONST_MIN_WIDTH(...) \
     { \
-        .prop = LV_STYLE_MIN_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MIN_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MAX_WIDTH(val) \
+#define LV_STYLE_CONST_MAX_WIDTH(...) \
     { \
-        .prop = LV_STYLE_MAX_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MAX_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_HEIGHT(val) \
+#define LV_STYLE_CONST_HEIGHT(...) \
     { \
-        .prop = LV_STYLE_HEIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_HEIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MIN_HEIGHT(val) \
+#define LV_STYLE_CONST_MIN_HEIGHT(...) \
     { \
-        .prop = LV_STYLE_MIN_HEIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MIN_HEIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MAX_HEIGHT(val) \
+#define LV_STYLE_CONST_MAX_HEIGHT(...) \
     { \
-        .prop = LV_STYLE_MAX_HEIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MAX_HEIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LENGTH(val) \
+#define LV_STYLE_CONST_LENGTH(...) \
     { \
-        .prop = LV_STYLE_LENGTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LENGTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_X(val) \
+#define LV_STYLE_CONST_X(...) \
     { \
-        .prop = LV_STYLE_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_Y(val) \
+#define LV_STYLE_CONST_Y(...) \
     { \
-        .prop = LV_STYLE_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ALIGN(val) \
+#define LV_STYLE_CONST_ALIGN(...) \
     { \
-        .prop = LV_STYLE_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_WIDTH(val) \
+#define LV_STYLE_CONST_TRANSFORM_WIDTH(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_HEIGHT(val) \
+#define LV_STYLE_CONST_TRANSFORM_HEIGHT(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_HEIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_HEIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSLATE_X(val) \
+#define LV_STYLE_CONST_TRANSLATE_X(...) \
     { \
-        .prop = LV_STYLE_TRANSLATE_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSLATE_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSLATE_Y(val) \
+#define LV_STYLE_CONST_TRANSLATE_Y(...) \
     { \
-        .prop = LV_STYLE_TRANSLATE_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSLATE_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSLATE_RADIAL(val) \
+#define LV_STYLE_CONST_TRANSLATE_RADIAL(...) \
     { \
-        .prop = LV_STYLE_TRANSLATE_RADIAL, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSLATE_RADIAL, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_SCALE_X(val) \
+#define LV_STYLE_CONST_TRANSFORM_SCALE_X(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_SCALE_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_SCALE_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_SCALE_Y(val) \
+#define LV_STYLE_CONST_TRANSFORM_SCALE_Y(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_SCALE_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_SCALE_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_ROTATION(val) \
+#define LV_STYLE_CONST_TRANSFORM_ROTATION(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_ROTATION, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_ROTATION, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_PIVOT_X(val) \
+#define LV_STYLE_CONST_TRANSFORM_PIVOT_X(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_PIVOT_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_PIVOT_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_PIVOT_Y(val) \
+#define LV_STYLE_CONST_TRANSFORM_PIVOT_Y(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_PIVOT_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_PIVOT_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_SKEW_X(val) \
+#define LV_STYLE_CONST_TRANSFORM_SKEW_X(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_SKEW_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_SKEW_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSFORM_SKEW_Y(val) \
+#define LV_STYLE_CONST_TRANSFORM_SKEW_Y(...) \
     { \
-        .prop = LV_STYLE_TRANSFORM_SKEW_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TRANSFORM_SKEW_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_TOP(val) \
+#define LV_STYLE_CONST_PAD_TOP(...) \
     { \
-        .prop = LV_STYLE_PAD_TOP, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_TOP, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_BOTTOM(val) \
+#define LV_STYLE_CONST_PAD_BOTTOM(...) \
     { \
-        .prop = LV_STYLE_PAD_BOTTOM, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_BOTTOM, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_LEFT(val) \
+#define LV_STYLE_CONST_PAD_LEFT(...) \
     { \
-        .prop = LV_STYLE_PAD_LEFT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_LEFT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_RIGHT(val) \
+#define LV_STYLE_CONST_PAD_RIGHT(...) \
     { \
-        .prop = LV_STYLE_PAD_RIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_RIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_ROW(val) \
+#define LV_STYLE_CONST_PAD_ROW(...) \
     { \
-        .prop = LV_STYLE_PAD_ROW, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_ROW, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_COLUMN(val) \
+#define LV_STYLE_CONST_PAD_COLUMN(...) \
     { \
-        .prop = LV_STYLE_PAD_COLUMN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_COLUMN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_PAD_RADIAL(val) \
+#define LV_STYLE_CONST_PAD_RADIAL(...) \
     { \
-        .prop = LV_STYLE_PAD_RADIAL, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_PAD_RADIAL, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MARGIN_TOP(val) \
+#define LV_STYLE_CONST_MARGIN_TOP(...) \
     { \
-        .prop = LV_STYLE_MARGIN_TOP, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MARGIN_TOP, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MARGIN_BOTTOM(val) \
+#define LV_STYLE_CONST_MARGIN_BOTTOM(...) \
     { \
-        .prop = LV_STYLE_MARGIN_BOTTOM, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MARGIN_BOTTOM, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MARGIN_LEFT(val) \
+#define LV_STYLE_CONST_MARGIN_LEFT(...) \
     { \
-        .prop = LV_STYLE_MARGIN_LEFT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MARGIN_LEFT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_MARGIN_RIGHT(val) \
+#define LV_STYLE_CONST_MARGIN_RIGHT(...) \
     { \
-        .prop = LV_STYLE_MARGIN_RIGHT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_MARGIN_RIGHT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_COLOR(val) \
+#define LV_STYLE_CONST_BG_COLOR(...) \
     { \
-        .prop = LV_STYLE_BG_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_BG_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_OPA(val) \
+#define LV_STYLE_CONST_BG_OPA(...) \
     { \
-        .prop = LV_STYLE_BG_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_GRAD_COLOR(val) \
+#define LV_STYLE_CONST_BG_GRAD_COLOR(...) \
     { \
-        .prop = LV_STYLE_BG_GRAD_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_BG_GRAD_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_GRAD_DIR(val) \
+#define LV_STYLE_CONST_BG_GRAD_DIR(...) \
     { \
-        .prop = LV_STYLE_BG_GRAD_DIR, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_GRAD_DIR, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_MAIN_STOP(val) \
+#define LV_STYLE_CONST_BG_MAIN_STOP(...) \
     { \
-        .prop = LV_STYLE_BG_MAIN_STOP, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_MAIN_STOP, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_GRAD_STOP(val) \
+#define LV_STYLE_CONST_BG_GRAD_STOP(...) \
     { \
-        .prop = LV_STYLE_BG_GRAD_STOP, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_GRAD_STOP, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_MAIN_OPA(val) \
+#define LV_STYLE_CONST_BG_MAIN_OPA(...) \
     { \
-        .prop = LV_STYLE_BG_MAIN_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_MAIN_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_GRAD_OPA(val) \
+#define LV_STYLE_CONST_BG_GRAD_OPA(...) \
     { \
-        .prop = LV_STYLE_BG_GRAD_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_GRAD_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_GRAD(val) \
+#define LV_STYLE_CONST_BG_GRAD(...) \
     { \
-        .prop = LV_STYLE_BG_GRAD, .value = { .ptr = val } \
+        .prop = LV_STYLE_BG_GRAD, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_IMAGE_SRC(val) \
+#define LV_STYLE_CONST_BG_IMAGE_SRC(...) \
     { \
-        .prop = LV_STYLE_BG_IMAGE_SRC, .value = { .ptr = val } \
+        .prop = LV_STYLE_BG_IMAGE_SRC, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_IMAGE_OPA(val) \
+#define LV_STYLE_CONST_BG_IMAGE_OPA(...) \
     { \
-        .prop = LV_STYLE_BG_IMAGE_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_IMAGE_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_IMAGE_RECOLOR(val) \
+#define LV_STYLE_CONST_BG_IMAGE_RECOLOR(...) \
     { \
-        .prop = LV_STYLE_BG_IMAGE_RECOLOR, .value = { .color = val } \
+        .prop = LV_STYLE_BG_IMAGE_RECOLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_IMAGE_RECOLOR_OPA(val) \
+#define LV_STYLE_CONST_BG_IMAGE_RECOLOR_OPA(...) \
     { \
-        .prop = LV_STYLE_BG_IMAGE_RECOLOR_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_IMAGE_RECOLOR_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BG_IMAGE_TILED(val) \
+#define LV_STYLE_CONST_BG_IMAGE_TILED(...) \
     { \
-        .prop = LV_STYLE_BG_IMAGE_TILED, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BG_IMAGE_TILED, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BORDER_COLOR(val) \
+#define LV_STYLE_CONST_BORDER_COLOR(...) \
     { \
-        .prop = LV_STYLE_BORDER_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_BORDER_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BORDER_OPA(val) \
+#define LV_STYLE_CONST_BORDER_OPA(...) \
     { \
-        .prop = LV_STYLE_BORDER_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BORDER_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BORDER_WIDTH(val) \
+#define LV_STYLE_CONST_BORDER_WIDTH(...) \
     { \
-        .prop = LV_STYLE_BORDER_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BORDER_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BORDER_SIDE(val) \
+#define LV_STYLE_CONST_BORDER_SIDE(...) \
     { \
-        .prop = LV_STYLE_BORDER_SIDE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BORDER_SIDE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BORDER_POST(val) \
+#define LV_STYLE_CONST_BORDER_POST(...) \
     { \
-        .prop = LV_STYLE_BORDER_POST, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BORDER_POST, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OUTLINE_WIDTH(val) \
+#define LV_STYLE_CONST_OUTLINE_WIDTH(...) \
     { \
-        .prop = LV_STYLE_OUTLINE_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_OUTLINE_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OUTLINE_COLOR(val) \
+#define LV_STYLE_CONST_OUTLINE_COLOR(...) \
     { \
-        .prop = LV_STYLE_OUTLINE_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_OUTLINE_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OUTLINE_OPA(val) \
+#define LV_STYLE_CONST_OUTLINE_OPA(...) \
     { \
-        .prop = LV_STYLE_OUTLINE_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_OUTLINE_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OUTLINE_PAD(val) \
+#define LV_STYLE_CONST_OUTLINE_PAD(...) \
     { \
-        .prop = LV_STYLE_OUTLINE_PAD, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_OUTLINE_PAD, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_WIDTH(val) \
+#define LV_STYLE_CONST_SHADOW_WIDTH(...) \
     { \
-        .prop = LV_STYLE_SHADOW_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_SHADOW_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_OFFSET_X(val) \
+#define LV_STYLE_CONST_SHADOW_OFFSET_X(...) \
     { \
-        .prop = LV_STYLE_SHADOW_OFFSET_X, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_SHADOW_OFFSET_X, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_OFFSET_Y(val) \
+#define LV_STYLE_CONST_SHADOW_OFFSET_Y(...) \
     { \
-        .prop = LV_STYLE_SHADOW_OFFSET_Y, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_SHADOW_OFFSET_Y, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_SPREAD(val) \
+#define LV_STYLE_CONST_SHADOW_SPREAD(...) \
     { \
-        .prop = LV_STYLE_SHADOW_SPREAD, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_SHADOW_SPREAD, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_COLOR(val) \
+#define LV_STYLE_CONST_SHADOW_COLOR(...) \
     { \
-        .prop = LV_STYLE_SHADOW_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_SHADOW_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_SHADOW_OPA(val) \
+#define LV_STYLE_CONST_SHADOW_OPA(...) \
     { \
-        .prop = LV_STYLE_SHADOW_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_SHADOW_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_IMAGE_OPA(val) \
+#define LV_STYLE_CONST_IMAGE_OPA(...) \
     { \
-        .prop = LV_STYLE_IMAGE_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_IMAGE_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_IMAGE_RECOLOR(val) \
+#define LV_STYLE_CONST_IMAGE_RECOLOR(...) \
     { \
-        .prop = LV_STYLE_IMAGE_RECOLOR, .value = { .color = val } \
+        .prop = LV_STYLE_IMAGE_RECOLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_IMAGE_RECOLOR_OPA(val) \
+#define LV_STYLE_CONST_IMAGE_RECOLOR_OPA(...) \
     { \
-        .prop = LV_STYLE_IMAGE_RECOLOR_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_IMAGE_RECOLOR_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_WIDTH(val) \
+#define LV_STYLE_CONST_LINE_WIDTH(...) \
     { \
-        .prop = LV_STYLE_LINE_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LINE_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_DASH_WIDTH(val) \
+#define LV_STYLE_CONST_LINE_DASH_WIDTH(...) \
     { \
-        .prop = LV_STYLE_LINE_DASH_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LINE_DASH_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_DASH_GAP(val) \
+#define LV_STYLE_CONST_LINE_DASH_GAP(...) \
     { \
-        .prop = LV_STYLE_LINE_DASH_GAP, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LINE_DASH_GAP, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_ROUNDED(val) \
+#define LV_STYLE_CONST_LINE_ROUNDED(...) \
     { \
-        .prop = LV_STYLE_LINE_ROUNDED, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LINE_ROUNDED, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_COLOR(val) \
+#define LV_STYLE_CONST_LINE_COLOR(...) \
     { \
-        .prop = LV_STYLE_LINE_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_LINE_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LINE_OPA(val) \
+#define LV_STYLE_CONST_LINE_OPA(...) \
     { \
-        .prop = LV_STYLE_LINE_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LINE_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ARC_WIDTH(val) \
+#define LV_STYLE_CONST_ARC_WIDTH(...) \
     { \
-        .prop = LV_STYLE_ARC_WIDTH, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ARC_WIDTH, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ARC_ROUNDED(val) \
+#define LV_STYLE_CONST_ARC_ROUNDED(...) \
     { \
-        .prop = LV_STYLE_ARC_ROUNDED, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ARC_ROUNDED, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ARC_COLOR(val) \
+#define LV_STYLE_CONST_ARC_COLOR(...) \
     { \
-        .prop = LV_STYLE_ARC_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_ARC_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ARC_OPA(val) \
+#define LV_STYLE_CONST_ARC_OPA(...) \
     { \
-        .prop = LV_STYLE_ARC_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ARC_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ARC_IMAGE_SRC(val) \
+#define LV_STYLE_CONST_ARC_IMAGE_SRC(...) \
     { \
-        .prop = LV_STYLE_ARC_IMAGE_SRC, .value = { .ptr = val } \
+        .prop = LV_STYLE_ARC_IMAGE_SRC, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_COLOR(val) \
+#define LV_STYLE_CONST_TEXT_COLOR(...) \
     { \
-        .prop = LV_STYLE_TEXT_COLOR, .value = { .color = val } \
+        .prop = LV_STYLE_TEXT_COLOR, .value = { .color = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_OPA(val) \
+#define LV_STYLE_CONST_TEXT_OPA(...) \
     { \
-        .prop = LV_STYLE_TEXT_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TEXT_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_FONT(val) \
+#define LV_STYLE_CONST_TEXT_FONT(...) \
     { \
-        .prop = LV_STYLE_TEXT_FONT, .value = { .ptr = val } \
+        .prop = LV_STYLE_TEXT_FONT, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_LETTER_SPACE(val) \
+#define LV_STYLE_CONST_TEXT_LETTER_SPACE(...) \
     { \
-        .prop = LV_STYLE_TEXT_LETTER_SPACE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TEXT_LETTER_SPACE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_LINE_SPACE(val) \
+#define LV_STYLE_CONST_TEXT_LINE_SPACE(...) \
     { \
-        .prop = LV_STYLE_TEXT_LINE_SPACE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TEXT_LINE_SPACE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_DECOR(val) \
+#define LV_STYLE_CONST_TEXT_DECOR(...) \
     { \
-        .prop = LV_STYLE_TEXT_DECOR, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TEXT_DECOR, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TEXT_ALIGN(val) \
+#define LV_STYLE_CONST_TEXT_ALIGN(...) \
     { \
-        .prop = LV_STYLE_TEXT_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_TEXT_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_RADIUS(val) \
+#define LV_STYLE_CONST_RADIUS(...) \
     { \
-        .prop = LV_STYLE_RADIUS, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_RADIUS, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_RADIAL_OFFSET(val) \
+#define LV_STYLE_CONST_RADIAL_OFFSET(...) \
     { \
-        .prop = LV_STYLE_RADIAL_OFFSET, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_RADIAL_OFFSET, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_CLIP_CORNER(val) \
+#define LV_STYLE_CONST_CLIP_CORNER(...) \
     { \
-        .prop = LV_STYLE_CLIP_CORNER, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_CLIP_CORNER, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OPA(val) \
+#define LV_STYLE_CONST_OPA(...) \
     { \
-        .prop = LV_STYLE_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_OPA_LAYERED(val) \
+#define LV_STYLE_CONST_OPA_LAYERED(...) \
     { \
-        .prop = LV_STYLE_OPA_LAYERED, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_OPA_LAYERED, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_COLOR_FILTER_DSC(val) \
+#define LV_STYLE_CONST_COLOR_FILTER_DSC(...) \
     { \
-        .prop = LV_STYLE_COLOR_FILTER_DSC, .value = { .ptr = val } \
+        .prop = LV_STYLE_COLOR_FILTER_DSC, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_COLOR_FILTER_OPA(val) \
+#define LV_STYLE_CONST_COLOR_FILTER_OPA(...) \
     { \
-        .prop = LV_STYLE_COLOR_FILTER_OPA, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_COLOR_FILTER_OPA, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ANIM(val) \
+#define LV_STYLE_CONST_ANIM(...) \
     { \
-        .prop = LV_STYLE_ANIM, .value = { .ptr = val } \
+        .prop = LV_STYLE_ANIM, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ANIM_DURATION(val) \
+#define LV_STYLE_CONST_ANIM_DURATION(...) \
     { \
-        .prop = LV_STYLE_ANIM_DURATION, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ANIM_DURATION, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_TRANSITION(val) \
+#define LV_STYLE_CONST_TRANSITION(...) \
     { \
-        .prop = LV_STYLE_TRANSITION, .value = { .ptr = val } \
+        .prop = LV_STYLE_TRANSITION, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BLEND_MODE(val) \
+#define LV_STYLE_CONST_BLEND_MODE(...) \
     { \
-        .prop = LV_STYLE_BLEND_MODE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BLEND_MODE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_LAYOUT(val) \
+#define LV_STYLE_CONST_LAYOUT(...) \
     { \
-        .prop = LV_STYLE_LAYOUT, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_LAYOUT, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BASE_DIR(val) \
+#define LV_STYLE_CONST_BASE_DIR(...) \
     { \
-        .prop = LV_STYLE_BASE_DIR, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_BASE_DIR, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_BITMAP_MASK_SRC(val) \
+#define LV_STYLE_CONST_BITMAP_MASK_SRC(...) \
     { \
-        .prop = LV_STYLE_BITMAP_MASK_SRC, .value = { .ptr = val } \
+        .prop = LV_STYLE_BITMAP_MASK_SRC, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_ROTARY_SENSITIVITY(val) \
+#define LV_STYLE_CONST_ROTARY_SENSITIVITY(...) \
     { \
-        .prop = LV_STYLE_ROTARY_SENSITIVITY, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_ROTARY_SENSITIVITY, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 #if LV_USE_FLEX
 
-#define LV_STYLE_CONST_FLEX_FLOW(val) \
+#define LV_STYLE_CONST_FLEX_FLOW(...) \
     { \
-        .prop = LV_STYLE_FLEX_FLOW, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_FLEX_FLOW, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_FLEX_MAIN_PLACE(val) \
+#define LV_STYLE_CONST_FLEX_MAIN_PLACE(...) \
     { \
-        .prop = LV_STYLE_FLEX_MAIN_PLACE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_FLEX_MAIN_PLACE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_FLEX_CROSS_PLACE(val) \
+#define LV_STYLE_CONST_FLEX_CROSS_PLACE(...) \
     { \
-        .prop = LV_STYLE_FLEX_CROSS_PLACE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_FLEX_CROSS_PLACE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_FLEX_TRACK_PLACE(val) \
+#define LV_STYLE_CONST_FLEX_TRACK_PLACE(...) \
     { \
-        .prop = LV_STYLE_FLEX_TRACK_PLACE, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_FLEX_TRACK_PLACE, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_FLEX_GROW(val) \
+#define LV_STYLE_CONST_FLEX_GROW(...) \
     { \
-        .prop = LV_STYLE_FLEX_GROW, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_FLEX_GROW, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 #endif /*LV_USE_FLEX*/
 
 #if LV_USE_GRID
 
-#define LV_STYLE_CONST_GRID_COLUMN_DSC_ARRAY(val) \
+#define LV_STYLE_CONST_GRID_COLUMN_DSC_ARRAY(...) \
     { \
-        .prop = LV_STYLE_GRID_COLUMN_DSC_ARRAY, .value = { .ptr = val } \
+        .prop = LV_STYLE_GRID_COLUMN_DSC_ARRAY, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_COLUMN_ALIGN(val) \
+#define LV_STYLE_CONST_GRID_COLUMN_ALIGN(...) \
     { \
-        .prop = LV_STYLE_GRID_COLUMN_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_COLUMN_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_ROW_DSC_ARRAY(val) \
+#define LV_STYLE_CONST_GRID_ROW_DSC_ARRAY(...) \
     { \
-        .prop = LV_STYLE_GRID_ROW_DSC_ARRAY, .value = { .ptr = val } \
+        .prop = LV_STYLE_GRID_ROW_DSC_ARRAY, .value = { .ptr = __VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_ROW_ALIGN(val) \
+#define LV_STYLE_CONST_GRID_ROW_ALIGN(...) \
     { \
-        .prop = LV_STYLE_GRID_ROW_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_ROW_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_COLUMN_POS(val) \
+#define LV_STYLE_CONST_GRID_CELL_COLUMN_POS(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_COLUMN_POS, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_COLUMN_POS, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_X_ALIGN(val) \
+#define LV_STYLE_CONST_GRID_CELL_X_ALIGN(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_X_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_X_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_COLUMN_SPAN(val) \
+#define LV_STYLE_CONST_GRID_CELL_COLUMN_SPAN(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_COLUMN_SPAN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_COLUMN_SPAN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_ROW_POS(val) \
+#define LV_STYLE_CONST_GRID_CELL_ROW_POS(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_ROW_POS, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_ROW_POS, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_Y_ALIGN(val) \
+#define LV_STYLE_CONST_GRID_CELL_Y_ALIGN(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_Y_ALIGN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_Y_ALIGN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 
-#define LV_STYLE_CONST_GRID_CELL_ROW_SPAN(val) \
+#define LV_STYLE_CONST_GRID_CELL_ROW_SPAN(...) \
     { \
-        .prop = LV_STYLE_GRID_CELL_ROW_SPAN, .value = { .num = (int32_t)val } \
+        .prop = LV_STYLE_GRID_CELL_ROW_SPAN, .value = { .num = (int32_t)__VA_ARGS__ } \
     }
 #endif /*LV_USE_GRID*/
 
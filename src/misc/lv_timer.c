@@ -20,6 +20,8 @@
 
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_DEF_CAPACITY 16
+#define NOT_IN_HEAP UINT32_MAX
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
@@ -31,9 +33,15 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static bool heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_pop_ready(void);
+static uint32_t heap_collect_ready(void);
+static void heap_restore_ran(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,43 +98,27 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
+    /*Take the ready timers from the heap and run them in the order of the timer list,
+     *then check again as the callbacks could make other timers ready. The timers which ran are kept out
+     *of the heap until the end of this call, so each timer runs at most once even if its period is 0*/
+    while(heap_collect_ready() > 0) {
+        uint32_t i;
+        for(i = 0; i < state_p->ready_cnt; i++) {
+            lv_timer_t * timer_active = state_p->ready[i];
+            /*Skip it if an other callback has deleted, paused, reset or resumed it*/
+            if(timer_active == NULL || timer_active->paused) continue;
+            if(timer_active->heap_index < state_p->heap_cnt) continue;
+            if(lv_timer_time_remaining(timer_active) > 0) continue;
+
+            lv_timer_exec(timer_active);
         }
-    } while(timer_active);
+        state_p->ready_cnt = 0;
+    }
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+    heap_restore_ran();
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
-    }
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_cnt > 0) time_until_next = lv_timer_time_remaining(state_p->heap[0]);
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -177,8 +169,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->heap_index = NOT_IN_HEAP;
+    new_timer->seq = state.next_seq++;
 
-    state.timer_created = true;
+    if(!heap_insert(new_timer)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
 
     lv_timer_handler_resume();
 
@@ -193,8 +191,14 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+
+    uint32_t i;
+    for(i = 0; i < state.ready_cnt; i++) {
+        if(state.ready[i] == timer) state.ready[i] = NULL;
+    }
 
     lv_free(timer);
 }
@@ -203,12 +207,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_index == NOT_IN_HEAP) heap_insert(timer);
     lv_timer_handler_resume();
 }
 
@@ -216,12 +222,14 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
@@ -246,6 +254,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +269,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.ran_cnt = 0;
+    state.heap_capacity = 0;
+
+    lv_free(state.ready);
+    state.ready = NULL;
+    state.ready_cnt = 0;
+    state.ready_capacity = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -304,38 +324,32 @@ bool lv_timer_get_paused(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute a ready timer
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    /* Decrement the repeat count before executing the timer_cb.
+     * This way the callback already sees the remaining repeat count.*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+    state.timer_exec = timer;
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(state.timer_exec) {
+        LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
     }
+    else {
+        LV_TRACE_TIMER("timer callback finished");
+    }
+
+    LV_ASSERT_MEM_INTEGRITY();
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    if(state.timer_exec) { /*The timer might be deleted by itself as well*/
+        state.timer_exec = NULL;
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -347,8 +361,6 @@ static bool lv_timer_exec(lv_timer_t * timer)
             }
         }
     }
-
-    return exec;
 }
 
 /**
@@ -365,6 +377,176 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
     return timer->period - elp;
 }
 
+/**
+ * Get the key of a timer in the heap: the tick of its next run.
+ * Longer than ~24 days periods are limited to keep the difference of the keys in the `int32_t` range.
+ * @param timer pointer to lv_timer
+ * @return the tick of the next run
+ */
+static uint32_t heap_key(const lv_timer_t * timer)
+{
+    return timer->last_run + LV_MIN(timer->period, INT32_MAX);
+}
+
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*The difference handles the overflow of the tick*/
+    return (int32_t)(heap_key(a) - heap_key(b)) < 0;
+}
+
+static void heap_swap(uint32_t i, uint32_t j)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * tmp = heap[i];
+    heap[i] = heap[j];
+    heap[j] = tmp;
+    heap[i]->heap_index = i;
+    heap[j]->heap_index = j;
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_less(state.heap[i], state.heap[parent])) break;
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    while(1) {
+        uint32_t min = i;
+        uint32_t left = 2 * i + 1;
+        uint32_t right = left + 1;
+        if(left < state.heap_cnt && heap_less(state.heap[left], state.heap[min])) min = left;
+        if(right < state.heap_cnt && heap_less(state.heap[right], state.heap[min])) min = right;
+        if(min == i) break;
+        heap_swap(i, min);
+        i = min;
+    }
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer pointer to lv_timer
+ * @return true: added, false: out of memory
+ */
+static bool heap_insert(lv_timer_t * timer)
+{
+    uint32_t total = state.heap_cnt + state.ran_cnt;
+    if(total == state.heap_capacity) {
+        uint32_t capacity = state.heap_capacity ? state.heap_capacity * 2 : HEAP_DEF_CAPACITY;
+        lv_timer_t ** heap = lv_realloc(state.heap, capacity * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(heap);
+        if(heap == NULL) return false;
+        state.heap = heap;
+        state.heap_capacity = capacity;
+    }
+
+    /*Append it and make room for it in the heap by moving the first timer which already ran to the end*/
+    state.heap[total] = timer;
+    timer->heap_index = total;
+    if(state.ran_cnt > 0) heap_swap(state.heap_cnt, total);
+    state.heap_cnt++;
+    heap_sift_up(timer->heap_index);
+
+    return true;
+}
+
+/**
+ * Remove a timer from the heap or from the timers which already ran, if it's in any of them
+ * @param timer pointer to lv_timer
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    if(timer->heap_index == NOT_IN_HEAP) return;
+
+    if(timer->heap_index < state.heap_cnt) {
+        /*Swap it with the last timer of the heap and handle it as if it had already run*/
+        uint32_t i = timer->heap_index;
+        state.heap_cnt--;
+        state.ran_cnt++;
+        heap_swap(i, state.heap_cnt);
+        if(i < state.heap_cnt) heap_update(state.heap[i]);
+    }
+
+    /*The order of the timers which already ran doesn't matter*/
+    heap_swap(timer->heap_index, state.heap_cnt + state.ran_cnt - 1);
+    state.ran_cnt--;
+    timer->heap_index = NOT_IN_HEAP;
+}
+
+/**
+ * Restore the order of the heap after the next run of a timer has changed.
+ * The timers which already ran are sorted in only at the end of `lv_timer_handler()`.
+ * @param timer pointer to lv_timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_index >= state.heap_cnt) return;
+
+    heap_sift_up(timer->heap_index);
+    heap_sift_down(timer->heap_index);
+}
+
+/**
+ * Move the first timer of the heap among the timers which already ran
+ */
+static void heap_pop_ready(void)
+{
+    state.heap_cnt--;
+    state.ran_cnt++;
+    heap_swap(0, state.heap_cnt);
+    heap_sift_down(0);
+}
+
+/**
+ * Move the ready timers from the heap among the timers which already ran and collect them
+ * into `ready` from the newest to the oldest, i.e. in the order of the timer list.
+ * @return number of ready timers
+ */
+static uint32_t heap_collect_ready(void)
+{
+    while(state.heap_cnt > 0 && lv_timer_time_remaining(state.heap[0]) == 0) {
+        if(state.ready_cnt == state.ready_capacity) {
+            uint32_t capacity = state.ready_capacity ? state.ready_capacity * 2 : HEAP_DEF_CAPACITY;
+            lv_timer_t ** ready = lv_realloc(state.ready, capacity * sizeof(lv_timer_t *));
+            LV_ASSERT_MALLOC(ready);
+            if(ready == NULL) break;
+            state.ready = ready;
+            state.ready_capacity = capacity;
+        }
+
+        lv_timer_t * timer = state.heap[0];
+        heap_pop_ready();
+
+        /*Usually only a few timers are ready at once so insertion sort is fine*/
+        uint32_t i = state.ready_cnt;
+        while(i > 0 && (int32_t)(state.ready[i - 1]->seq - timer->seq) < 0) {
+            state.ready[i] = state.ready[i - 1];
+            i--;
+        }
+        state.ready[i] = timer;
+        state.ready_cnt++;
+    }
+
+    return state.ready_cnt;
+}
+
+/**
+ * Sort the timers which already ran back into the heap
+ */
+static void heap_restore_ran(void)
+{
+    while(state.ran_cnt > 0) {
+        state.ran_cnt--;
+        state.heap_cnt++;
+        heap_sift_up(state.heap_cnt - 1);
+    }
+}
+
 /**
  * Call the ready lv_timer
  */
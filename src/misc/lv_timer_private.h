@@ -33,6 +33,8 @@ struct _lv_timer_t {
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
+    uint32_t heap_index;       /**< Index in the heap of the running timers */
+    uint32_t seq;              /**< Creation order, the ready timers run from the newest like in the list */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 };
@@ -40,10 +42,22 @@ struct _lv_timer_t {
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    /** The not paused timers. The first `heap_cnt` are a binary min-heap ordered by the time of
+     * their next run, the next `ran_cnt` already ran in the current `lv_timer_handler()` call.*/
+    lv_timer_t ** heap;
+    uint32_t heap_cnt;
+    uint32_t ran_cnt;
+    uint32_t heap_capacity;
+    uint32_t next_seq;
+
+    lv_timer_t ** ready;       /**< The ready timers to run in creation order, NULL if deleted meanwhile*/
+    uint32_t ready_cnt;
+    uint32_t ready_capacity;
+
+    lv_timer_t * timer_exec;   /**< The timer whose callback is running, NULL if the callback deleted it*/
+
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
@@ -104,6 +104,7 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_task_index_t lv_draw_task_index_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -165,6 +166,10 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+typedef struct _lv_obj_style_resolved_t lv_obj_style_resolved_t;
+#endif
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
@@ -251,6 +256,8 @@ typedef struct _lv_tileview_t lv_tileview_t;
 
 typedef struct _lv_tileview_tile_t lv_tileview_tile_t;
 
+typedef struct _lv_virtuallist_t lv_virtuallist_t;
+
 typedef struct _lv_win_t lv_win_t;
 
 typedef struct _lv_observer_t lv_observer_t;
@@ -346,6 +353,10 @@ typedef struct _lv_sysmon_backend_data_t lv_sysmon_backend_data_t;
 typedef struct _lv_sysmon_perf_info_t lv_sysmon_perf_info_t;
 #endif /*LV_USE_PERF_MONITOR*/
 
+#if LV_SYSMON_FRAME_STATS_CNT
+typedef struct _lv_sysmon_frame_stats_ctx_t lv_sysmon_frame_stats_ctx_t;
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
 #endif /*LV_USE_SYSMON*/
 
 #endif /*__ASSEMBLY__*/
@@ -12,6 +12,7 @@
 
 #include <errno.h>
 #include "../misc/lv_log.h"
+#include "../stdlib/lv_mem_private.h"
 
 /*********************
  *      DEFINES
@@ -172,6 +173,12 @@ static void * generic_callback(void * user_data)
 {
     lv_thread_t * thread = user_data;
     thread->callback(thread->user_data);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    /*Nobody else can give back the memory blocks cached by this thread*/
+    lv_mem_thread_cache_release();
+#endif
+
     return NULL;
 }
 
@@ -13,6 +13,8 @@
 
 #include <process.h>
 
+#include "../stdlib/lv_mem_private.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -216,6 +218,11 @@ static unsigned __stdcall thread_start_routine(void * parameter)
         free(init_data);
     }
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    /*Nobody else can give back the memory blocks cached by this thread*/
+    lv_mem_thread_cache_release();
+#endif
+
     return 0;
 }
 
@@ -13,10 +13,14 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define pending_head LV_GLOBAL_DEFAULT()->subject_pending_head
+#define pending_tail LV_GLOBAL_DEFAULT()->subject_pending_tail
+#define batch_depth LV_GLOBAL_DEFAULT()->subject_batch_depth
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +34,10 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void notify_observers(lv_subject_t * subject);
+static void notify_pending(bool with_deferred);
+static void add_pending(lv_subject_t * subject);
+static void remove_pending(lv_subject_t * subject);
 static void unsubscribe_on_delete_cb(lv_event_t * e);
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject);
 static lv_observer_t * bind_to_bitfield(lv_subject_t * subject, lv_obj_t * obj, lv_observer_cb_t cb, uint32_t flag,
@@ -273,6 +281,7 @@ lv_color_t lv_subject_get_previous_color(lv_subject_t * subject)
 
 void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32_t list_len)
 {
+    lv_memzero(subject, sizeof(lv_subject_t));
     subject->type = LV_SUBJECT_TYPE_GROUP;
     subject->size = list_len;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
@@ -288,6 +297,8 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->notify_pending) remove_pending(subject);
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -422,21 +433,52 @@ void lv_subject_notify(lv_subject_t * subject)
 {
     LV_ASSERT_NULL(subject);
 
-    lv_observer_t * observer;
-    LV_LL_READ(&(subject->subs_ll), observer) {
-        observer->notified = 0;
+    if(subject->deferred || batch_depth > 0) {
+        add_pending(subject);
+        return;
     }
 
-    do {
-        subject->notify_restart_query = 0;
-        LV_LL_READ(&(subject->subs_ll), observer) {
-            if(observer->cb && observer->notified == 0) {
-                observer->cb(observer, subject);
-                if(subject->notify_restart_query) break;
-                observer->notified = 1;
-            }
-        }
-    } while(subject->notify_restart_query);
+    notify_observers(subject);
+}
+
+void lv_subject_set_deferred(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+
+    subject->deferred = en;
+
+    /*Don't keep the observers waiting for the next refresh*/
+    if(!en && subject->notify_pending && batch_depth == 0) {
+        remove_pending(subject);
+        notify_observers(subject);
+    }
+}
+
+void lv_subject_batch_begin(void)
+{
+    batch_depth++;
+}
+
+void lv_subject_batch_end(void)
+{
+    if(batch_depth == 0) {
+        LV_LOG_WARN("No batch was started");
+        return;
+    }
+
+    batch_depth--;
+
+    /*The deferred subjects are kept for the next refresh*/
+    if(batch_depth == 0) notify_pending(false);
+}
+
+void lv_subject_notify_deferred(void)
+{
+    if(pending_head == NULL) return;
+
+    LV_PROFILER_BEGIN;
+    notify_pending(true);
+    LV_PROFILER_END;
 }
 
 lv_observer_t * lv_obj_bind_flag_if_eq(lv_obj_t * obj, lv_subject_t * subject, lv_obj_flag_t flag, int32_t ref_value)
@@ -589,6 +631,86 @@ void * lv_observer_get_user_data(const lv_observer_t * observer)
  *   STATIC FUNCTIONS
  **********************/
 
+static void notify_observers(lv_subject_t * subject)
+{
+    lv_observer_t * observer;
+    LV_LL_READ(&(subject->subs_ll), observer) {
+        observer->notified = 0;
+    }
+
+    do {
+        subject->notify_restart_query = 0;
+        LV_LL_READ(&(subject->subs_ll), observer) {
+            if(observer->cb && observer->notified == 0) {
+                observer->cb(observer, subject);
+                if(subject->notify_restart_query) break;
+                observer->notified = 1;
+            }
+        }
+    } while(subject->notify_restart_query);
+}
+
+/* Notify the observers of the pending subjects in the order they were changed.
+ * The subjects changed by the observers are collected too and notified in the same round,
+ * so e.g. a group is notified only once even if several of its elements changed. */
+static void notify_pending(bool with_deferred)
+{
+    batch_depth++;
+
+    lv_subject_t * subject = pending_head;
+    while(subject) {
+        if(with_deferred || !subject->deferred) {
+            remove_pending(subject);
+            notify_observers(subject);
+            /*The observers might have changed the list*/
+            subject = pending_head;
+        }
+        else {
+            subject = subject->pending_next;
+        }
+    }
+
+    batch_depth--;
+}
+
+/* Append a subject to the list of deferred notifications (once) and request a refresh to deliver them */
+static void add_pending(lv_subject_t * subject)
+{
+    if(subject->notify_pending) return;
+
+    subject->notify_pending = 1;
+    subject->pending_next = NULL;
+    if(pending_tail) pending_tail->pending_next = subject;
+    else pending_head = subject;
+    pending_tail = subject;
+
+    /*The refresh timers are paused if there is nothing to redraw*/
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+        disp = lv_display_get_next(disp);
+    }
+}
+
+static void remove_pending(lv_subject_t * subject)
+{
+    lv_subject_t * prev = NULL;
+    lv_subject_t * s = pending_head;
+    while(s && s != subject) {
+        prev = s;
+        s = s->pending_next;
+    }
+
+    if(s == NULL) return;
+
+    if(prev) prev->pending_next = subject->pending_next;
+    else pending_head = subject->pending_next;
+    if(pending_tail == subject) pending_tail = prev;
+
+    subject->pending_next = NULL;
+    subject->notify_pending = 0;
+}
+
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
 {
     LV_UNUSED(subject);
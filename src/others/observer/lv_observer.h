@@ -50,13 +50,16 @@ typedef union {
 /**
  * The subject (an observable value)
  */
-typedef struct {
+typedef struct _lv_subject_t {
     lv_ll_t subs_ll;                    /**< Subscribers*/
     uint32_t type   : 4;
     uint32_t size   : 28;               /**< Might be used to store a size related to `type`*/
     lv_subject_value_t value;           /**< Actual value*/
     lv_subject_value_t prev_value;      /**< Previous value*/
     uint32_t notify_restart_query : 1; /**< If an observer deleted start notifying from the beginning. */
+    uint32_t deferred : 1;              /**< Notify the observers only before the next refresh*/
+    uint32_t notify_pending : 1;        /**< The subject is waiting in the list of deferred notifications*/
+    struct _lv_subject_t * pending_next; /**< Next subject in the list of deferred notifications*/
     void * user_data;                   /**< Additional parameter, can be used freely by the user*/
 } lv_subject_t;
 
@@ -290,11 +293,39 @@ lv_obj_t * lv_observer_get_target_obj(lv_observer_t * observer);
 void * lv_observer_get_user_data(const lv_observer_t * observer);
 
 /**
- * Notify all observers of subject
+ * Notify all observers of subject.
+ * If the subject is deferred or a batch is in progress, the observers are notified only later.
  * @param subject       pointer to a subject
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Defer the notifications of a subject. The observers of a deferred subject are notified
+ * only once right before the next display refresh, even if the subject was set several times.
+ * @param subject       pointer to a subject
+ * @param en            true: defer the notifications; false: notify the observers immediately
+ */
+void lv_subject_set_deferred(lv_subject_t * subject, bool en);
+
+/**
+ * Start a batch of subject updates. Until the matching `lv_subject_batch_end()`
+ * the observers are not notified, only the changed subjects are collected.
+ * Batches can be nested.
+ */
+void lv_subject_batch_begin(void);
+
+/**
+ * End a batch of subject updates. At the end of the outermost batch the observers
+ * of each changed subject are notified once, with the last value.
+ */
+void lv_subject_batch_end(void);
+
+/**
+ * Notify the observers of the subjects which were changed while deferred or in a batch.
+ * It's called automatically before each display refresh.
+ */
+void lv_subject_notify_deferred(void);
+
 /**
  * Set an object flag if an integer subject's value is equal to a reference value, clear the flag otherwise
  * @param obj           pointer to an object
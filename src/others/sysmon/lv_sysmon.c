@@ -17,6 +17,11 @@
 #include "../../stdlib/lv_string.h"
 #include "../../widgets/label/lv_label.h"
 #include "../../display/lv_display_private.h"
+#include "../../draw/lv_draw_private.h"
+#include "../../core/lv_refr_private.h"
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
+    #include "../../misc/lv_profiler_builtin.h"
+#endif
 
 /*********************
  *      DEFINES
@@ -48,6 +53,12 @@
     static void mem_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
 #endif
 
+#if LV_SYSMON_FRAME_STATS_CNT
+    static uint32_t ticks_to_us(uint32_t ticks, uint32_t tick_per_sec);
+    static lv_sysmon_frame_unit_stats_t * get_unit_stats(lv_sysmon_frame_stats_ctx_t * ctx,
+                                                         lv_draw_unit_t * draw_unit);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -172,6 +183,150 @@ void lv_sysmon_hide_memory(lv_display_t * disp)
 
 #endif
 
+#if LV_SYSMON_FRAME_STATS_CNT
+
+uint32_t lv_sysmon_get_frame_stats(lv_display_t * disp, lv_sysmon_frame_stats_t * stats, uint32_t max_cnt)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        LV_LOG_WARN("There is no default display");
+        return 0;
+    }
+
+    lv_sysmon_frame_stats_ctx_t * ctx = &disp->frame_stats;
+    uint32_t cnt = LV_MIN(max_cnt, ctx->record_cnt);
+
+    /*Copy the last `cnt` records, the oldest first*/
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        uint32_t idx = (ctx->record_next + LV_SYSMON_FRAME_STATS_CNT - cnt + i) % LV_SYSMON_FRAME_STATS_CNT;
+        stats[i] = ctx->records[idx];
+    }
+
+    return cnt;
+}
+
+void lv_sysmon_clear_frame_stats(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        LV_LOG_WARN("There is no default display");
+        return;
+    }
+
+    disp->frame_stats.record_cnt = 0;
+    disp->frame_stats.record_next = 0;
+}
+
+uint32_t lv_sysmon_frame_stats_tick(void)
+{
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
+    return lv_profiler_builtin_get_tick(NULL);
+#else
+    return lv_tick_get();
+#endif
+}
+
+void lv_sysmon_frame_stats_begin(lv_display_t * disp)
+{
+    lv_sysmon_frame_stats_ctx_t * ctx = &disp->frame_stats;
+    lv_memzero(&ctx->act, sizeof(ctx->act));
+    ctx->dispatch_sum = 0;
+
+    /*The draw units only add to their own counters, the difference is taken at the end of the frame*/
+    uint32_t i = 0;
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u && i < LV_SYSMON_FRAME_STATS_UNIT_CNT; u = u->next) {
+        ctx->exec_start_ticks[i] = u->exec_ticks;
+        i++;
+    }
+
+    ctx->start_tick = lv_sysmon_frame_stats_tick();
+    ctx->act.timestamp = lv_tick_get();
+    ctx->in_progress = 1;
+}
+
+void lv_sysmon_frame_stats_end(lv_display_t * disp)
+{
+    lv_sysmon_frame_stats_ctx_t * ctx = &disp->frame_stats;
+    lv_sysmon_frame_stats_t * act = &ctx->act;
+    ctx->in_progress = 0;
+
+    /*Save only the frames which redrew something*/
+    if(disp->inv_stats.area_cnt == 0) return;
+
+    uint32_t tick_per_sec = 1000;
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
+    lv_profiler_builtin_get_tick(&tick_per_sec);
+#endif
+
+    /*All the draw tasks of the frame are ready, so the draw units have added their rendering time*/
+    uint32_t i = 0;
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u && i < LV_SYSMON_FRAME_STATS_UNIT_CNT; u = u->next) {
+        act->units[i].name = u->name;
+        act->units[i].exec_us = u->exec_ticks - ctx->exec_start_ticks[i];
+        i++;
+    }
+
+    act->id = ctx->frame_cnt;
+    act->total_us = lv_sysmon_frame_stats_tick() - ctx->start_tick;
+    act->interval_us = ctx->frame_cnt ? ctx->start_tick - ctx->last_start_tick : 0;
+    act->area_cnt = disp->inv_stats.area_cnt;
+    act->px_cnt = disp->inv_stats.px_cnt;
+
+    /*Whatever is not measured separately in the rendering is spent with creating the draw tasks*/
+    uint32_t measured = ctx->dispatch_sum + act->draw_wait_us + act->flush_wait_us + act->flush_cb_us;
+    act->draw_create_us = act->render_us > measured ? act->render_us - measured : 0;
+
+    act->total_us = ticks_to_us(act->total_us, tick_per_sec);
+    act->interval_us = ticks_to_us(act->interval_us, tick_per_sec);
+    act->layout_us = ticks_to_us(act->layout_us, tick_per_sec);
+    act->render_us = ticks_to_us(act->render_us, tick_per_sec);
+    act->draw_create_us = ticks_to_us(act->draw_create_us, tick_per_sec);
+    act->draw_wait_us = ticks_to_us(act->draw_wait_us, tick_per_sec);
+    act->flush_wait_us = ticks_to_us(act->flush_wait_us, tick_per_sec);
+    act->flush_cb_us = ticks_to_us(act->flush_cb_us, tick_per_sec);
+
+    for(i = 0; i < LV_SYSMON_FRAME_STATS_UNIT_CNT; i++) {
+        act->units[i].dispatch_us = ticks_to_us(act->units[i].dispatch_us, tick_per_sec);
+        act->units[i].exec_us = ticks_to_us(act->units[i].exec_us, tick_per_sec);
+    }
+
+    ctx->records[ctx->record_next] = *act;
+    ctx->record_next = (ctx->record_next + 1) % LV_SYSMON_FRAME_STATS_CNT;
+    if(ctx->record_cnt < LV_SYSMON_FRAME_STATS_CNT) ctx->record_cnt++;
+
+    ctx->frame_cnt++;
+    ctx->last_start_tick = ctx->start_tick;
+}
+
+void lv_sysmon_frame_stats_add_task(void)
+{
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp == NULL || !disp->frame_stats.in_progress) return;
+
+    disp->frame_stats.act.task_cnt++;
+}
+
+void lv_sysmon_frame_stats_add_dispatch(lv_display_t * disp, lv_draw_unit_t * draw_unit, int32_t taken_cnt,
+                                        uint32_t start_tick)
+{
+    lv_sysmon_frame_stats_ctx_t * ctx = &disp->frame_stats;
+    if(!ctx->in_progress) return;
+
+    uint32_t elaps = lv_sysmon_frame_stats_tick() - start_tick;
+    ctx->dispatch_sum += elaps;
+
+    lv_sysmon_frame_unit_stats_t * unit = get_unit_stats(ctx, draw_unit);
+    if(unit == NULL) return;
+
+    unit->dispatch_us += elaps;
+    if(taken_cnt > 0) unit->task_cnt += taken_cnt;
+}
+
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -332,4 +487,30 @@ static void mem_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
 
 #endif
 
+#if LV_SYSMON_FRAME_STATS_CNT
+
+static uint32_t ticks_to_us(uint32_t ticks, uint32_t tick_per_sec)
+{
+    return (uint32_t)(((uint64_t)ticks * 1000000) / tick_per_sec);
+}
+
+static lv_sysmon_frame_unit_stats_t * get_unit_stats(lv_sysmon_frame_stats_ctx_t * ctx,
+                                                     lv_draw_unit_t * draw_unit)
+{
+    /*Find the index of the draw unit*/
+    uint32_t i = 0;
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u && u != draw_unit) {
+        u = u->next;
+        i++;
+    }
+    if(u == NULL || i >= LV_SYSMON_FRAME_STATS_UNIT_CNT) return NULL;
+
+    lv_sysmon_frame_unit_stats_t * unit = &ctx->act.units[i];
+    unit->name = draw_unit->name;
+    return unit;
+}
+
+#endif
+
 #endif /*LV_USE_SYSMON*/
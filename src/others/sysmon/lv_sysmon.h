@@ -31,10 +31,53 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_SYSMON_FRAME_STATS_CNT
+#ifndef LV_SYSMON_FRAME_STATS_UNIT_CNT
+/** Number of draw units whose statistics are stored in a frame record*/
+#define LV_SYSMON_FRAME_STATS_UNIT_CNT 4
+#endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_SYSMON_FRAME_STATS_CNT
+
+typedef struct {
+    const char * name;          /**< Name of the draw unit*/
+    uint32_t dispatch_us;       /**< Time spent in the dispatch callback of the draw unit. Units with their own
+                                 *   thread only start the tasks here, see `exec_us` for those.*/
+    uint32_t exec_us;           /**< Time spent with rendering the draw tasks, also in the draw unit's own
+                                 *   thread. Only measured by the software renderer, 0 for other draw units.*/
+    uint32_t task_cnt;          /**< Number of draw tasks taken by the draw unit*/
+} lv_sysmon_frame_unit_stats_t;
+
+/**
+ * Timings and counters of a refresh of a display.
+ * The times are in microseconds. They are measured with the tick source of the built-in profiler
+ * if it's initialized, else with `lv_tick_get()`, i.e. with 1 ms resolution.
+ */
+typedef struct {
+    uint32_t id;                /**< Index of the recorded frame on the display*/
+    uint32_t timestamp;         /**< `lv_tick_get()` when the refresh started*/
+    uint32_t interval_us;       /**< Time since the start of the previous recorded frame*/
+    uint32_t total_us;          /**< Duration of the whole refresh*/
+    uint32_t layout_us;         /**< Updating the layouts*/
+    uint32_t render_us;         /**< Refreshing the invalidated areas. Contains the times below.*/
+    uint32_t draw_create_us;    /**< Walking the widgets and creating the draw tasks*/
+    uint32_t draw_wait_us;      /**< Waiting for the draw units to finish the draw tasks*/
+    uint32_t flush_wait_us;     /**< Waiting for the display to finish the previous flush*/
+    uint32_t flush_cb_us;       /**< Spent in the flush callback*/
+    uint32_t area_cnt;          /**< Number of refreshed areas*/
+    uint32_t px_cnt;            /**< Number of refreshed pixels*/
+    uint32_t flush_cnt;         /**< Number of flush callback calls*/
+    uint32_t task_cnt;          /**< Number of created draw tasks*/
+    lv_sysmon_frame_unit_stats_t units[LV_SYSMON_FRAME_STATS_UNIT_CNT]; /**< In the order of the draw unit list*/
+} lv_sysmon_frame_stats_t;
+
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -78,6 +121,25 @@ void lv_sysmon_hide_memory(lv_display_t * disp);
 
 #endif /*LV_USE_MEM_MONITOR*/
 
+#if LV_SYSMON_FRAME_STATS_CNT
+
+/**
+ * Get the last recorded frames of a display. Only the refreshes which redrew something are recorded.
+ * @param disp      pointer to a display, NULL: use the default display
+ * @param stats     store the records here, the oldest first
+ * @param max_cnt   size of `stats`. At most `LV_SYSMON_FRAME_STATS_CNT` records are available.
+ * @return          number of records stored in `stats`
+ */
+uint32_t lv_sysmon_get_frame_stats(lv_display_t * disp, lv_sysmon_frame_stats_t * stats, uint32_t max_cnt);
+
+/**
+ * Remove all the recorded frames of a display
+ * @param disp      pointer to a display, NULL: use the default display
+ */
+void lv_sysmon_clear_frame_stats(lv_display_t * disp);
+
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
 /**********************
  *      MACROS
  **********************/
@@ -64,6 +64,21 @@ struct _lv_sysmon_perf_info_t {
 };
 #endif
 
+#if LV_SYSMON_FRAME_STATS_CNT
+struct _lv_sysmon_frame_stats_ctx_t {
+    lv_sysmon_frame_stats_t records[LV_SYSMON_FRAME_STATS_CNT];
+    lv_sysmon_frame_stats_t act;    /**< The frame being measured. The times are in ticks until it's finished.*/
+    uint32_t record_cnt;            /**< Number of valid records*/
+    uint32_t record_next;           /**< Index of the record to write next*/
+    uint32_t frame_cnt;             /**< Number of recorded frames since the display was created*/
+    uint32_t dispatch_sum;          /**< Time spent in the dispatch callbacks of all the draw units [tick]*/
+    uint32_t exec_start_ticks[LV_SYSMON_FRAME_STATS_UNIT_CNT]; /**< `exec_ticks` of the draw units at the start*/
+    uint32_t start_tick;
+    uint32_t last_start_tick;
+    uint32_t in_progress : 1;
+};
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -78,11 +93,69 @@ void lv_sysmon_builtin_init(void);
  */
 void lv_sysmon_builtin_deinit(void);
 
+#if LV_SYSMON_FRAME_STATS_CNT
+
+/**
+ * Get the current tick used for the frame statistics
+ * @return      the current tick of the built-in profiler if it's initialized, else `lv_tick_get()`
+ */
+uint32_t lv_sysmon_frame_stats_tick(void);
+
+/**
+ * Start measuring a new frame
+ * @param disp  pointer to the display being refreshed
+ */
+void lv_sysmon_frame_stats_begin(lv_display_t * disp);
+
+/**
+ * Finish measuring the frame and save it if something was redrawn
+ * @param disp  pointer to the display being refreshed
+ */
+void lv_sysmon_frame_stats_end(lv_display_t * disp);
+
+/**
+ * Count a draw task created while a display is being refreshed
+ */
+void lv_sysmon_frame_stats_add_task(void);
+
+/**
+ * Save the result of calling the dispatch callback of a draw unit
+ * @param disp          pointer to the display whose layer was dispatched
+ * @param draw_unit     pointer to the draw unit
+ * @param taken_cnt     the return value of the dispatch callback
+ * @param start_tick    the tick before calling the dispatch callback
+ */
+void lv_sysmon_frame_stats_add_dispatch(lv_display_t * disp, lv_draw_unit_t * draw_unit, int32_t taken_cnt,
+                                        uint32_t start_tick);
+
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
+#endif /* LV_USE_SYSMON */
+
 /**********************
  *      MACROS
  **********************/
 
-#endif /* LV_USE_SYSMON */
+#if LV_SYSMON_FRAME_STATS_CNT
+#define LV_SYSMON_FRAME_STATS_BEGIN(disp)       lv_sysmon_frame_stats_begin(disp)
+#define LV_SYSMON_FRAME_STATS_END(disp)         lv_sysmon_frame_stats_end(disp)
+#define LV_SYSMON_FRAME_STATS_TICK(tick)        uint32_t tick = lv_sysmon_frame_stats_tick()
+#define LV_SYSMON_FRAME_STATS_ADD(disp, field, tick) \
+    (disp)->frame_stats.act.field += lv_sysmon_frame_stats_tick() - (tick)
+#define LV_SYSMON_FRAME_STATS_ADD_TASK()        lv_sysmon_frame_stats_add_task()
+#define LV_SYSMON_FRAME_STATS_ADD_DISPATCH(disp, draw_unit, taken_cnt, tick) \
+    lv_sysmon_frame_stats_add_dispatch(disp, draw_unit, taken_cnt, tick)
+#define LV_SYSMON_FRAME_STATS_ADD_EXEC(draw_unit, tick) \
+    (draw_unit)->exec_ticks += lv_sysmon_frame_stats_tick() - (tick)
+#else
+#define LV_SYSMON_FRAME_STATS_BEGIN(disp)
+#define LV_SYSMON_FRAME_STATS_END(disp)
+#define LV_SYSMON_FRAME_STATS_TICK(tick)
+#define LV_SYSMON_FRAME_STATS_ADD(disp, field, tick)
+#define LV_SYSMON_FRAME_STATS_ADD_TASK()
+#define LV_SYSMON_FRAME_STATS_ADD_DISPATCH(disp, draw_unit, taken_cnt, tick)
+#define LV_SYSMON_FRAME_STATS_ADD_EXEC(draw_unit, tick)
+#endif
 
 #ifdef __cplusplus
 } /*extern "C"*/
@@ -5,7 +5,7 @@
 /*********************
  *      INCLUDES
  *********************/
-#include "../lv_mem.h"
+#include "../lv_mem_private.h"
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
 
 #include "lv_tlsf.h"
@@ -38,6 +38,27 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_THREAD_CACHE
+    #if LV_USE_OS == LV_OS_NONE
+        #define THREAD_LOCAL
+    #elif LV_USE_OS != LV_OS_PTHREAD && LV_USE_OS != LV_OS_WINDOWS
+        /*The caches are given back when an `lv_thread` exits, but only these OSAL backends do it and
+         *the thread local variables of the compiler might not work with the threads of an RTOS*/
+        #error "LV_MEM_THREAD_CACHE is supported only with LV_OS_NONE, LV_OS_PTHREAD and LV_OS_WINDOWS"
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define THREAD_LOCAL _Thread_local
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define THREAD_LOCAL __thread
+    #elif defined(_MSC_VER)
+        #define THREAD_LOCAL __declspec(thread)
+    #else
+        #error "LV_MEM_THREAD_CACHE requires thread local variables"
+    #endif
+
+    /*Number of blocks to allocate or free with one lock of the heap*/
+    #define THREAD_CACHE_BATCH  LV_MAX(LV_MEM_THREAD_CACHE / 2, 1)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,10 +67,28 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if LV_MEM_THREAD_CACHE
+    static lv_mem_thread_cache_t * get_thread_cache(void);
+    static void * thread_cache_refill(lv_mem_thread_cache_t * cache, uint32_t class_id);
+    static void thread_cache_flush(lv_mem_thread_cache_t * cache, uint32_t class_id, uint32_t cnt);
+    static void thread_cache_flush_all(void);
+    static bool has_other_thread_cache(void);
+    static uint32_t get_alloc_class(size_t size);
+    static uint32_t get_block_class(size_t block_size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_MEM_THREAD_CACHE
+static const uint16_t class_size[LV_MEM_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+
+/*Thread local variables can't be in `lv_global_t`. `thread_cache_gen` tells if `thread_cache`
+ *was created by the current `lv_mem_init()`*/
+static THREAD_LOCAL lv_mem_thread_cache_t * thread_cache;
+static THREAD_LOCAL uint32_t thread_cache_gen;
+static uint32_t cache_gen;
+#endif
 
 /**********************
  *      MACROS
@@ -86,6 +125,12 @@ void lv_mem_init(void)
     state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
 
+#if LV_MEM_THREAD_CACHE
+    /*The caches of the previous init are invalid*/
+    state.thread_cache_head = NULL;
+    cache_gen++;
+#endif
+
     lv_ll_init(&state.pool_ll, sizeof(lv_pool_t));
 
     /*Record the first pool*/
@@ -101,6 +146,10 @@ void lv_mem_init(void)
 void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
+#if LV_MEM_THREAD_CACHE
+    state.thread_cache_head = NULL;
+    cache_gen++;
+#endif
     lv_tlsf_destroy(state.tlsf);
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
@@ -124,11 +173,23 @@ lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes)
 
 void lv_mem_remove_pool(lv_mem_pool_t pool)
 {
+#if LV_MEM_THREAD_CACHE
+    /*The cached blocks are still used for TLSF and only their own thread can give them back*/
+    if(has_other_thread_cache()) {
+        LV_LOG_WARN("can't remove pool %p while other threads have memory caches", pool);
+        return;
+    }
+#endif
+
     lv_pool_t * pool_p;
     LV_LL_READ(&state.pool_ll, pool_p) {
         if(*pool_p == pool) {
             lv_ll_remove(&state.pool_ll, pool_p);
             lv_free(pool_p);
+#if LV_MEM_THREAD_CACHE
+            /*The cache itself could be in the removed pool too*/
+            lv_mem_thread_cache_release();
+#endif
             lv_tlsf_remove_pool(state.tlsf, pool);
             return;
         }
@@ -138,6 +199,25 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
 
 void * lv_malloc_core(size_t size)
 {
+#if LV_MEM_THREAD_CACHE
+    uint32_t class_id = get_alloc_class(size);
+    if(class_id < LV_MEM_CLASS_CNT) {
+        lv_mem_thread_cache_t * cache = get_thread_cache();
+        if(cache) {
+            cache->alloc_cnt[class_id]++;
+            void * block = cache->free_list[class_id];
+            if(block) {
+                cache->free_list[class_id] = *(void **)block;
+                cache->cached_cnt[class_id]--;
+                cache->cached_size -= lv_tlsf_block_size(block);
+                cache->hit_cnt[class_id]++;
+                return block;
+            }
+            return thread_cache_refill(cache, class_id);
+        }
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -177,6 +257,25 @@ void * lv_realloc_core(void * p, size_t new_size)
 
 void lv_free_core(void * p)
 {
+#if LV_MEM_THREAD_CACHE
+    /*The block belongs to the caller so its header can be read without locking*/
+    size_t block_size = lv_tlsf_block_size(p);
+    uint32_t class_id = get_block_class(block_size);
+    if(class_id < LV_MEM_CLASS_CNT) {
+        lv_mem_thread_cache_t * cache = get_thread_cache();
+        if(cache) {
+            if(cache->cached_cnt[class_id] >= LV_MEM_THREAD_CACHE) {
+                thread_cache_flush(cache, class_id, THREAD_CACHE_BATCH);
+            }
+            *(void **)p = cache->free_list[class_id];
+            cache->free_list[class_id] = p;
+            cache->cached_cnt[class_id]++;
+            cache->cached_size += block_size;
+            return;
+        }
+    }
+#endif
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
@@ -200,11 +299,44 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     LV_TRACE_MEM("begin");
 
+#if LV_MEM_THREAD_CACHE
+    /*Give back the blocks cached by this thread to see the real state of the heap*/
+    thread_cache_flush_all();
+#endif
+
     lv_pool_t * pool_p;
     LV_LL_READ(&state.pool_ll, pool_p) {
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
+#if LV_MEM_THREAD_CACHE
+    /*The blocks cached by the other threads are used for TLSF but they are available for LVGL.
+     *The other threads might change their counters meanwhile, so it's only an estimation.*/
+    uint32_t i;
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        mon_p->classes[i].size = class_size[i];
+    }
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_mem_thread_cache_t * cache;
+    for(cache = state.thread_cache_head; cache; cache = cache->next) {
+        for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+            mon_p->classes[i].cached_cnt += cache->cached_cnt[i];
+            mon_p->classes[i].alloc_cnt += cache->alloc_cnt[i];
+            mon_p->classes[i].hit_cnt += cache->hit_cnt[i];
+            mon_p->free_cnt += cache->cached_cnt[i];
+            mon_p->used_cnt -= cache->cached_cnt[i];
+        }
+        mon_p->cached_size += cache->cached_size;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+    mon_p->free_size += mon_p->cached_size;
+#endif
+
     mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -219,6 +351,43 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
     LV_TRACE_MEM("finished");
 }
 
+size_t lv_mem_get_free_size_with_headers(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_core(&mon);
+
+    /*When two free blocks are merged the header of one of them becomes free memory too*/
+    return mon.free_size + mon.free_cnt * lv_tlsf_alloc_overhead();
+}
+
+#if LV_MEM_THREAD_CACHE
+void lv_mem_thread_cache_release(void)
+{
+    if(thread_cache == NULL) return;
+
+    if(thread_cache_gen == cache_gen) {
+        thread_cache_flush_all();
+
+#if LV_USE_OS
+        lv_mutex_lock(&state.mutex);
+#endif
+        lv_mem_thread_cache_t ** cache_p = &state.thread_cache_head;
+        while(*cache_p != thread_cache) cache_p = &(*cache_p)->next;
+        *cache_p = thread_cache->next;
+
+        size_t size = lv_tlsf_block_size(thread_cache);
+        lv_tlsf_free(state.tlsf, thread_cache);
+        if(state.cur_used > size) state.cur_used -= size;
+        else state.cur_used = 0;
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+    }
+
+    thread_cache = NULL;
+}
+#endif
+
 lv_result_t lv_mem_test_core(void)
 {
 #if LV_USE_OS
@@ -270,4 +439,156 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+#if LV_MEM_THREAD_CACHE
+
+static lv_mem_thread_cache_t * get_thread_cache(void)
+{
+    if(thread_cache && thread_cache_gen == cache_gen) return thread_cache;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_mem_thread_cache_t * cache = lv_tlsf_malloc(state.tlsf, sizeof(lv_mem_thread_cache_t));
+    if(cache) {
+        lv_memzero(cache, sizeof(lv_mem_thread_cache_t));
+        cache->next = state.thread_cache_head;
+        state.thread_cache_head = cache;
+
+        state.cur_used += lv_tlsf_block_size(cache);
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    if(cache == NULL) return NULL;
+
+    thread_cache = cache;
+    thread_cache_gen = cache_gen;
+    return cache;
+}
+
+/**
+ * Allocate a few blocks of a class with one lock. One is returned, the others are cached.
+ */
+static void * thread_cache_refill(lv_mem_thread_cache_t * cache, uint32_t class_id)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    void * p = lv_tlsf_malloc(state.tlsf, class_size[class_id]);
+    if(p) {
+        state.cur_used += lv_tlsf_block_size(p);
+
+        uint32_t i;
+        for(i = 1; i < THREAD_CACHE_BATCH; i++) {
+            void * block = lv_tlsf_malloc(state.tlsf, class_size[class_id]);
+            if(block == NULL) break;
+
+            state.cur_used += lv_tlsf_block_size(block);
+            *(void **)block = cache->free_list[class_id];
+            cache->free_list[class_id] = block;
+            cache->cached_cnt[class_id]++;
+            cache->cached_size += lv_tlsf_block_size(block);
+        }
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    return p;
+}
+
+/**
+ * Give back some cached blocks of a class to the heap with one lock.
+ */
+static void thread_cache_flush(lv_mem_thread_cache_t * cache, uint32_t class_id, uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    while(cnt && cache->free_list[class_id]) {
+        void * block = cache->free_list[class_id];
+        cache->free_list[class_id] = *(void **)block;
+        cache->cached_cnt[class_id]--;
+        cache->cached_size -= lv_tlsf_block_size(block);
+        cnt--;
+
+        size_t size = lv_tlsf_block_size(block);
+        lv_tlsf_free(state.tlsf, block);
+        if(state.cur_used > size) state.cur_used -= size;
+        else state.cur_used = 0;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
+
+/**
+ * Give back all the blocks cached by the current thread
+ */
+static void thread_cache_flush_all(void)
+{
+    if(thread_cache == NULL || thread_cache_gen != cache_gen) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        thread_cache_flush(thread_cache, i, thread_cache->cached_cnt[i]);
+    }
+}
+
+/**
+ * Check if a thread other than the current one has a cache
+ */
+static bool has_other_thread_cache(void)
+{
+    lv_mem_thread_cache_t * own_cache = thread_cache_gen == cache_gen ? thread_cache : NULL;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_mem_thread_cache_t * cache;
+    for(cache = state.thread_cache_head; cache; cache = cache->next) {
+        if(cache != own_cache) break;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    return cache != NULL;
+}
+
+/**
+ * The smallest class which can serve an allocation
+ */
+static uint32_t get_alloc_class(size_t size)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        if(size <= class_size[i]) return i;
+    }
+    return LV_MEM_CLASS_CNT;
+}
+
+/**
+ * The largest class a freed block can serve. TLSF might return larger blocks than
+ * requested (e.g. it has a minimum block size), but the much larger blocks are given back to the heap.
+ */
+static uint32_t get_block_class(size_t block_size)
+{
+    uint32_t i;
+    for(i = LV_MEM_CLASS_CNT; i > 0; i--) {
+        uint32_t s = class_size[i - 1];
+        if(block_size >= s) {
+            return block_size < s * 2 ? i - 1 : LV_MEM_CLASS_CNT;
+        }
+    }
+    return LV_MEM_CLASS_CNT;
+}
+
+#endif /*LV_MEM_THREAD_CACHE*/
 #endif /*LV_STDLIB_BUILTIN*/
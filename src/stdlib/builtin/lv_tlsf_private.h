@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os.h"
 
 /*********************
@@ -27,6 +28,20 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_THREAD_CACHE
+/**
+ * Free small blocks of a thread, to allocate them without locking the heap.
+ */
+typedef struct _lv_mem_thread_cache_t {
+    struct _lv_mem_thread_cache_t * next;
+    void * free_list[LV_MEM_CLASS_CNT];     /**< The first word of each free block points to the next one*/
+    uint32_t cached_cnt[LV_MEM_CLASS_CNT];
+    uint32_t alloc_cnt[LV_MEM_CLASS_CNT];
+    uint32_t hit_cnt[LV_MEM_CLASS_CNT];
+    size_t cached_size;                     /**< Size of the cached blocks with their TLSF overhead*/
+} lv_mem_thread_cache_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +50,9 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_THREAD_CACHE
+    lv_mem_thread_cache_t * thread_cache_head;
+#endif
 } lv_tlsf_state_t;
 
 /**********************
@@ -23,12 +23,30 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+/** Number of size classes of the thread caches*/
+#define LV_MEM_CLASS_CNT    8
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 typedef void * lv_mem_pool_t;
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+/**
+ * Statistics of a size class of the thread caches, summed for all threads.
+ * `lv_mem_monitor()` gives back the blocks cached by the calling thread to the heap.
+ */
+typedef struct {
+    uint32_t size;          /**< The largest allocation served from this class */
+    uint32_t cached_cnt;    /**< Number of free blocks kept in the caches of the other threads */
+    uint32_t alloc_cnt;     /**< Number of allocations in this class */
+    uint32_t hit_cnt;       /**< Number of allocations served from a cache without locking the heap */
+} lv_mem_class_monitor_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +59,10 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    size_t cached_size; /**< Size of the free blocks kept in the caches of the other threads (included in `free_size`) */
+    lv_mem_class_monitor_t classes[LV_MEM_CLASS_CNT];
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -59,6 +81,12 @@ void lv_mem_deinit(void);
 
 lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes);
 
+/**
+ * Remove a memory pool added by `lv_mem_add_pool()`. It shouldn't contain allocated memory.
+ * With `LV_MEM_THREAD_CACHE` the pool can be removed only if no other thread has a memory cache,
+ * i.e. the other threads using the heap have exited.
+ * @param pool      the pool to remove
+ */
 void lv_mem_remove_pool(lv_mem_pool_t pool);
 
 /**
@@ -28,6 +28,25 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+/**
+ * Get the free memory of the builtin heap, counting the headers of the free blocks too.
+ * Unlike `free_size` of `lv_mem_monitor()` it doesn't depend on how the free memory is fragmented,
+ * so it's the same again after freeing all the memory allocated meanwhile, e.g. to find leaks.
+ * @return      the free memory in bytes
+ */
+size_t lv_mem_get_free_size_with_headers(void);
+#endif
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+/**
+ * Give back the blocks cached by the calling thread to the heap and delete its cache.
+ * Called by the OS layer when an `lv_thread` exits, as no other thread can free the cached blocks.
+ * The thread gets a new cache if it allocates memory again.
+ */
+void lv_mem_thread_cache_release(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -44,6 +44,11 @@ static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static bool envelope_refresh(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w);
+static void envelope_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id);
+static void envelope_calc(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x);
+static void draw_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer, lv_draw_line_dsc_t * line_dsc,
+                          int32_t x_ofs, int32_t y_ofs, int32_t h, const lv_area_t * clip_area);
 
 /**********************
  *  STATIC VARIABLES
@@ -285,6 +290,13 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The points might have been changed directly in the arrays*/
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->envelope_valid = 0;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -362,6 +374,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    lv_free(series->envelope);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -492,6 +505,7 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+    envelope_update(obj, ser, ser->start_point);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -523,6 +537,7 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    envelope_update(obj, ser, id);
     invalidate_point(obj, id);
 }
 
@@ -552,6 +567,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->envelope_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -652,6 +668,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        lv_free(ser->envelope);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -848,6 +865,14 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        /*Draw the min-max range of each x coordinate without going through all the points*/
+        if(crowded_mode && envelope_refresh(obj, ser, w)) {
+            draw_envelope(obj, ser, layer, &line_dsc, x_ofs, y_ofs, h, &clip_area_ori);
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
@@ -1378,4 +1403,123 @@ static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t c
     }
 }
 
+/**
+ * Calculate the min-max envelope of all x coordinates if it's not up to date.
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series
+ * @param w         content width of the chart
+ * @return          false if the envelope couldn't be allocated
+ */
+static bool envelope_refresh(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    if(ser->envelope_valid && ser->envelope_w == w && ser->envelope_start == start_point) return true;
+
+    if(ser->envelope == NULL || ser->envelope_w != w) {
+        int32_t * envelope = lv_realloc(ser->envelope, sizeof(int32_t) * 2 * w);
+        LV_ASSERT_MALLOC(envelope);
+        if(envelope == NULL) return false;
+        ser->envelope = envelope;
+        ser->envelope_w = w;
+    }
+
+    ser->envelope_start = start_point;
+
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        envelope_calc(obj, ser, x);
+    }
+
+    ser->envelope_valid = 1;
+    return true;
+}
+
+/**
+ * Update the envelope around a point whose value has changed
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series
+ * @param id        index of the changed point in `y_points`
+ */
+static void envelope_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!ser->envelope_valid) return;
+
+    /*If there are more points than pixels a point can be on the line of its own and the previous x coordinate.
+     *The line of an x coordinate can also end on the first point of the next x coordinate.*/
+    uint32_t i = (id + chart->point_cnt - ser->envelope_start) % chart->point_cnt;
+    int32_t x = (int32_t)(((int64_t)ser->envelope_w * i) / (chart->point_cnt - 1));
+    int32_t x_end = LV_MIN(x + 1, ser->envelope_w - 1);
+    for(x = LV_MAX(x - 1, 0); x <= x_end; x++) {
+        envelope_calc(obj, ser, x);
+    }
+}
+
+/**
+ * Calculate the min. and max. value drawn as a vertical line on an x coordinate.
+ * Like when drawing the points one-by-one the line goes from the first point on the x coordinate
+ * (or on the previous one if there is no point on it) to the first point on the next x coordinate.
+ * @param obj       pointer to a chart
+ * @param ser       pointer to a series
+ * @param x         the x coordinate relative to the content area
+ */
+static void envelope_calc(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t * envelope = &ser->envelope[2 * x];
+    int64_t w = ser->envelope_w;
+    int64_t last = chart->point_cnt - 1;
+
+    /*Min. > max. means there is no line on this x coordinate*/
+    envelope[0] = INT32_MAX;
+    envelope[1] = INT32_MIN;
+
+    /*The first point on the next x coordinate*/
+    uint32_t end = (uint32_t)(((x + 1) * last + w - 1) / w);
+    if(end > last || (w * end) / last != x + 1) return;
+
+    /*The first point on the x coordinate of the point before `end`*/
+    int64_t start_x = (w * (end - 1)) / last;
+    uint32_t i = (uint32_t)((start_x * last + w - 1) / w);
+
+    for(; i <= end; i++) {
+        int32_t v = ser->y_points[(ser->envelope_start + i) % chart->point_cnt];
+        if(v == LV_CHART_POINT_NONE) continue;
+        envelope[0] = LV_MIN(envelope[0], v);
+        envelope[1] = LV_MAX(envelope[1], v);
+    }
+}
+
+/**
+ * Draw the envelope of a series as vertical lines on the x coordinates of a clip area
+ */
+static void draw_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer, lv_draw_line_dsc_t * line_dsc,
+                          int32_t x_ofs, int32_t y_ofs, int32_t h, const lv_area_t * clip_area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t ymin = chart->ymin[ser->y_axis_sec];
+    int32_t yrange = chart->ymax[ser->y_axis_sec] - ymin;
+    int64_t w = ser->envelope_w;
+    int64_t last = chart->point_cnt - 1;
+
+    int32_t x_start = LV_MAX(clip_area->x1 - x_ofs - line_dsc->width, 0);
+    int32_t x_end = LV_MIN(clip_area->x2 - x_ofs + line_dsc->width, ser->envelope_w - 1);
+    int32_t x;
+    for(x = x_start; x <= x_end; x++) {
+        const int32_t * envelope = &ser->envelope[2 * x];
+        if(envelope[0] > envelope[1]) continue;
+
+        /*The max. value is on the top*/
+        line_dsc->p1.x = x + x_ofs;
+        line_dsc->p2.x = x + x_ofs;
+        line_dsc->p1.y = h - ((envelope[1] - ymin) * h) / yrange + y_ofs;
+        line_dsc->p2.y = h - ((envelope[0] - ymin) * h) / yrange + y_ofs;
+        if(line_dsc->p1.y == line_dsc->p2.y) line_dsc->p2.y++;    /*If they are the same no line will be drawn*/
+        /*Like without the envelope, the ID of the point where the line ends: the first one on the next x coordinate*/
+        line_dsc->base.id2 = (uint32_t)(((x + 1) * last + w - 1) / w);
+        lv_draw_line(layer, line_dsc);
+    }
+}
+
 #endif
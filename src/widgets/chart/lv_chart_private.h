@@ -33,6 +33,10 @@ extern "C" {
 struct _lv_chart_series_t {
     int32_t * x_points;
     int32_t * y_points;
+    int32_t * envelope;         /**< Min. and max. value of the points drawn on each x coordinate
+                                 *   if there are more points than pixels: `envelope[2 * x]` and `envelope[2 * x + 1]`*/
+    int32_t envelope_w;         /**< The width for which `envelope` was calculated*/
+    uint32_t envelope_start;    /**< The start point for which `envelope` was calculated*/
     lv_color_t color;
     uint32_t start_point;
     uint32_t hidden : 1;
@@ -40,6 +44,7 @@ struct _lv_chart_series_t {
     uint32_t y_ext_buf_assigned : 1;
     uint32_t x_axis_sec : 1;
     uint32_t y_axis_sec : 1;
+    uint32_t envelope_valid : 1;
 };
 
 struct _lv_chart_cursor_t {
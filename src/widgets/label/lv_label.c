@@ -11,6 +11,7 @@
 #include "../../misc/lv_anim_private.h"
 #include "../../draw/lv_draw_label_private.h"
 #include "../../core/lv_obj_class_private.h"
+#include "../../core/lv_obj_draw_private.h"
 #if LV_USE_LABEL != 0
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_assert.h"
@@ -34,6 +35,7 @@
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_BEGIN_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_LINES_MIN_LEN 1024 /*Keep the line breaks of texts longer than this in LV_LABEL_LONG_WRAP mode*/
 
 /**********************
  *      TYPEDEFS
@@ -56,6 +58,23 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+#if LV_LABEL_LONG_TXT_HINT
+static void lines_free(lv_label_t * label);
+static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t max_w, int32_t letter_space,
+                        lv_text_flag_t flag);
+static bool lines_reserve(lv_label_lines_t * lines, uint32_t cnt);
+static bool lines_break(lv_label_t * label, lv_label_lines_t * lines, uint32_t start, const lv_label_lines_t * old,
+                        uint32_t old_id, uint32_t edit_end, uint32_t del_len, uint32_t ins_len, uint32_t * same_line);
+static bool lines_refresh(lv_obj_t * obj, const lv_font_t * font, int32_t max_w, int32_t letter_space,
+                          lv_text_flag_t flag);
+static bool lines_is_word_start(const char * txt, uint32_t byte_id);
+static bool lines_update(lv_obj_t * obj, uint32_t byte_id, uint32_t del_len, uint32_t ins_len,
+                         uint32_t * first_line, uint32_t * same_line);
+static bool lines_edit(lv_obj_t * obj, uint32_t byte_id, uint32_t del_len, uint32_t ins_len);
+static void lines_get_size(lv_label_t * label, lv_point_t * size, int32_t letter_height, int32_t line_space);
+static uint32_t lines_get_line_on(int32_t y, int32_t letter_height, int32_t line_space);
+static uint32_t lines_get_line_of_byte(lv_label_t * label, uint32_t byte_id);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords, lv_text_flag_t flags);
 
@@ -138,6 +157,10 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+#if LV_LABEL_LONG_TXT_HINT
+    lines_free(label); /*The text might have been modified*/
+#endif
+
     lv_label_revert_dots(obj); /*In case text == label->text*/
     const size_t text_len = get_text_length(text);
 
@@ -180,6 +203,10 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
 
+#if LV_LABEL_LONG_TXT_HINT
+    lines_free(label);
+#endif
+
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
         lv_label_refr_text(obj);
@@ -205,6 +232,10 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
+#if LV_LABEL_LONG_TXT_HINT
+    lines_free(label);
+#endif
+
     if(label->static_txt == 0 && label->text != NULL) {
         lv_free(label->text);
         label->text = NULL;
@@ -342,16 +373,28 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LONG_TXT_HINT
+    if(lines_match(label, font, max_w, letter_space, flag)) {
+        uint32_t line = lines_get_line_of_byte(label, byte_id);
+        y = (int32_t)line * (letter_height + line_space);
+        line_start = label->lines.starts[line];
+        new_line_start = label->lines.starts[line + 1];
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL,
+                                                    flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -431,26 +474,48 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
     lv_text_flag_t flag = get_label_flags(label);
 
     /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        /*If dots will be shown, break the last visible line anywhere,
-         *not only at word boundaries.*/
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
-
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
-
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
+#if LV_LABEL_LONG_TXT_HINT
+    if(letter_height + line_space > 0 && lines_match(label, font, max_w, letter_space, flag)) {
+        uint32_t line = lines_get_line_on(pos.y, letter_height, line_space);
+        if(line < label->lines.cnt) {
+            line_start = label->lines.starts[line];
+            new_line_start = label->lines.starts[line + 1];
             /*Include the NULL terminator in the last line*/
             uint32_t tmp = new_line_start;
             uint32_t letter;
             letter = lv_text_encoded_prev(txt, &tmp);
             if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
         }
-        y += letter_height + line_space;
+        else {
+            line_start = label->lines.starts[label->lines.cnt];
+            new_line_start = line_start;
+        }
+    }
+    else
+#endif
+    {
+        while(txt[line_start] != '\0') {
+            /*If dots will be shown, break the last visible line anywhere,
+             *not only at word boundaries.*/
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL,
+                                                    flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = lv_text_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     char * bidi_txt;
@@ -553,17 +618,29 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     lv_text_flag_t flag = get_label_flags(label);
 
     /*Search the line of the index letter*/
-    int32_t y = 0;
-    while(txt[line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LONG_TXT_HINT
+    if(letter_height + line_space > 0 && lines_match(label, font, max_w, letter_space, flag)) {
+        uint32_t line = lines_get_line_on(pos->y, letter_height, line_space);
+        line = LV_MIN(line, label->lines.cnt);
+        line_start = label->lines.starts[line];
+        new_line_start = line < label->lines.cnt ? label->lines.starts[line + 1] : line_start;
+    }
+    else
+#endif
+    {
+        int32_t y = 0;
+        while(txt[line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL, flag);
+            new_line_start += lv_text_get_next_line(&txt[line_start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL,
+                                                    flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     /*Calculate the x coordinate*/
@@ -664,8 +741,6 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
     /*Cannot append to static text*/
     if(label->static_txt != 0) return;
 
-    lv_obj_invalidate(obj);
-
     /*Allocate space for the new text*/
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
@@ -678,8 +753,27 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
         pos = lv_text_get_encoded_length(label->text);
     }
 
+#if LV_LABEL_LONG_TXT_HINT
+    uint32_t byte_id = lv_text_encoded_get_byte_id(label->text, pos);
+#endif
     lv_text_ins(label->text, pos, txt);
-    lv_label_set_text(obj, NULL);
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The rest of the text is processed already so process it again only for non-ASCII letters*/
+    if(lv_text_get_encoded_length(txt) != ins_len) {
+        lv_obj_invalidate(obj);
+        lv_label_set_text(obj, NULL);
+        return;
+    }
+#endif
+
+#if LV_LABEL_LONG_TXT_HINT
+    /*Break and redraw only the lines around the new text*/
+    if(lines_edit(obj, byte_id, 0, ins_len)) return;
+#endif
+
+    lv_obj_invalidate(obj);
+    lv_label_refr_text(obj);
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -690,12 +784,21 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     /*Cannot append to static text*/
     if(label->static_txt) return;
 
-    lv_obj_invalidate(obj);
-
     char * label_txt = lv_label_get_text(obj);
+#if LV_LABEL_LONG_TXT_HINT
+    uint32_t byte_id = lv_text_encoded_get_byte_id(label_txt, pos);
+    size_t old_len = lv_strlen(label_txt);
+#endif
     /*Delete the characters*/
     lv_text_cut(label_txt, pos, cnt);
 
+#if LV_LABEL_LONG_TXT_HINT
+    /*Break and redraw only the lines around the removed text*/
+    if(lines_edit(obj, byte_id, old_len - lv_strlen(label_txt), 0)) return;
+#endif
+
+    lv_obj_invalidate(obj);
+
     /*Refresh the label*/
     lv_label_refr_text(obj);
 }
@@ -722,6 +825,9 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.line_start = -1;
     label->hint.coord_y    = 0;
     label->hint.y          = 0;
+    label->hint.line_starts = NULL;
+    label->hint.line_cnt   = 0;
+    lv_memzero(&label->lines, sizeof(label->lines));
 #endif
 
 #if LV_LABEL_TEXT_SELECTION
@@ -743,6 +849,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LONG_TXT_HINT
+    lines_free(label);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -783,10 +893,18 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
             else w = lv_obj_get_content_width(obj);
             w = LV_MIN(w, lv_obj_get_style_max_width(obj, 0));
 
-            uint32_t dot_begin = label->dot_begin;
-            lv_label_revert_dots(obj);
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
-            lv_label_set_dots(obj, dot_begin);
+#if LV_LABEL_LONG_TXT_HINT
+            if(lines_match(label, font, w, letter_space, flag)) {
+                lines_get_size(label, &label->size_cache, lv_font_get_line_height(font), line_space);
+            }
+            else
+#endif
+            {
+                uint32_t dot_begin = label->dot_begin;
+                lv_label_revert_dots(obj);
+                lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+                lv_label_set_dots(obj, dot_begin);
+            }
 
             label->invalid_size_cache = false;
         }
@@ -827,6 +945,17 @@ static void draw_main(lv_event_t * e)
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
+#if LV_LABEL_LONG_TXT_HINT
+    /*If the lines are known the drawing can start at the first visible line*/
+    label->hint.line_starts = NULL;
+    label->hint.line_cnt = 0;
+    if(lines_match(label, label_draw_dsc.font, lv_area_get_width(&txt_coords), label_draw_dsc.letter_space, flag)) {
+        label->hint.line_starts = label->lines.starts;
+        label->hint.line_cnt = label->lines.cnt;
+        label_draw_dsc.hint = &label->hint;
+    }
+#endif
+
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
     label_draw_dsc.sel_end = lv_label_get_text_selection_end(obj);
     if(label_draw_dsc.sel_start != LV_DRAW_LABEL_NO_TXT_SEL && label_draw_dsc.sel_end != LV_DRAW_LABEL_NO_TXT_SEL) {
@@ -946,7 +1075,15 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_text_flag_t flag = get_label_flags(label);
 
     lv_label_revert_dots(obj);
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#if LV_LABEL_LONG_TXT_HINT
+    if(lines_refresh(obj, font, max_w, letter_space, flag)) {
+        lines_get_size(label, &size, lv_font_get_line_height(font), line_space);
+    }
+    else
+#endif
+    {
+        lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
 
     lv_obj_refresh_self_size(obj);
 
@@ -1282,4 +1419,267 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+
+#if LV_LABEL_LONG_TXT_HINT
+
+static void lines_free(lv_label_t * label)
+{
+    lv_free(label->lines.starts);
+    lv_free(label->lines.widths);
+    lv_memzero(&label->lines, sizeof(label->lines));
+    label->hint.line_starts = NULL;
+    label->hint.line_cnt = 0;
+}
+
+static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t max_w, int32_t letter_space,
+                        lv_text_flag_t flag)
+{
+    lv_label_lines_t * lines = &label->lines;
+    return lines->starts != NULL && label->long_mode == LV_LABEL_LONG_WRAP &&
+           lines->font == font && lines->max_w == max_w && lines->letter_space == letter_space && lines->flag == flag;
+}
+
+/* Make room for `cnt` lines and the end of the text */
+static bool lines_reserve(lv_label_lines_t * lines, uint32_t cnt)
+{
+    if(cnt + 1 <= lines->cap) return true;
+
+    uint32_t cap = LV_MAX(cnt + 1, lines->cap * 2);
+    cap = LV_MAX(cap, 32);
+
+    uint32_t * starts = lv_realloc(lines->starts, cap * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(starts);
+    if(starts == NULL) return false;
+    lines->starts = starts;
+
+    int32_t * widths = lv_realloc(lines->widths, cap * sizeof(int32_t));
+    LV_ASSERT_MALLOC(widths);
+    if(widths == NULL) return false;
+    lines->widths = widths;
+
+    lines->cap = cap;
+    return true;
+}
+
+/**
+ * Break the text into lines from `start` and append them to `lines`.
+ * If `old` is not NULL, it has the lines of the text before `del_len` bytes were replaced with `ins_len` bytes.
+ * In this case the breaking stops when a line after the edit starts where an old line started
+ * as all the remaining lines are the same. The index of the first such line is stored in `same_line`.
+ */
+static bool lines_break(lv_label_t * label, lv_label_lines_t * lines, uint32_t start, const lv_label_lines_t * old,
+                        uint32_t old_id, uint32_t edit_end, uint32_t del_len, uint32_t ins_len, uint32_t * same_line)
+{
+    const char * txt = label->text;
+    if(same_line) *same_line = LV_LABEL_POS_LAST;
+
+    while(txt[start] != '\0') {
+        uint32_t end = start + lv_text_get_next_line(&txt[start], LV_TEXT_LEN_MAX, lines->font, lines->letter_space,
+                                                     lines->max_w, NULL, lines->flag);
+        if(!lines_reserve(lines, lines->cnt + 1)) return false;
+        lines->starts[lines->cnt] = start;
+        lines->widths[lines->cnt] = lv_text_get_width(&txt[start], end - start, lines->font, lines->letter_space);
+        lines->cnt++;
+        start = end;
+
+        if(old == NULL || start < edit_end) continue;
+
+        uint32_t old_start = start - ins_len + del_len;
+        while(old_id < old->cnt && old->starts[old_id] < old_start) old_id++;
+        if(old_id < old->cnt && old->starts[old_id] == old_start) {
+            uint32_t rest = old->cnt - old_id;
+            if(!lines_reserve(lines, lines->cnt + rest)) return false;
+            if(same_line) *same_line = lines->cnt;
+
+            uint32_t i;
+            for(i = 0; i < rest; i++) {
+                lines->starts[lines->cnt + i] = old->starts[old_id + i] - del_len + ins_len;
+            }
+            lv_memcpy(&lines->widths[lines->cnt], &old->widths[old_id], rest * sizeof(int32_t));
+            lines->cnt += rest;
+            start = old->starts[old->cnt] - del_len + ins_len;
+            break;
+        }
+    }
+
+    if(!lines_reserve(lines, lines->cnt)) return false;
+    lines->starts[lines->cnt] = start;
+    if(same_line && *same_line == LV_LABEL_POS_LAST) *same_line = lines->cnt;
+    return true;
+}
+
+/* Break the text into lines again if it's long and the lines were broken with other parameters */
+static bool lines_refresh(lv_obj_t * obj, const lv_font_t * font, int32_t max_w, int32_t letter_space,
+                          lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->long_mode != LV_LABEL_LONG_WRAP) {
+        lines_free(label);
+        return false;
+    }
+
+    if(lines_match(label, font, max_w, letter_space, flag)) return true;
+
+    lines_free(label);
+    if(lv_strlen(label->text) < LV_LABEL_LINES_MIN_LEN) return false;
+
+    label->lines.font = font;
+    label->lines.max_w = max_w;
+    label->lines.letter_space = letter_space;
+    label->lines.flag = flag;
+    if(!lines_break(label, &label->lines, 0, NULL, 0, 0, 0, 0, NULL)) {
+        lines_free(label);
+        return false;
+    }
+
+    return true;
+}
+
+/* Test if a line starting at `byte_id` starts at a word boundary */
+static bool lines_is_word_start(const char * txt, uint32_t byte_id)
+{
+    if(byte_id == 0) return true;
+
+    uint32_t i = byte_id;
+    uint32_t letter_prev = lv_text_encoded_prev(txt, &i);
+    i = byte_id;
+    uint32_t letter = lv_text_encoded_next(txt, &i);
+
+    return letter_prev == '\n' || letter_prev == '\r' || lv_text_is_break_char(letter_prev) ||
+           lv_text_is_a_word(letter_prev) || lv_text_is_a_word(letter);
+}
+
+/* Update the lines after `del_len` bytes were replaced with `ins_len` bytes at `byte_id`.
+ * The lines from `first_line` to `same_line` (exclusive) might be different. */
+static bool lines_update(lv_obj_t * obj, uint32_t byte_id, uint32_t del_len, uint32_t ins_len,
+                         uint32_t * first_line, uint32_t * same_line)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_label_lines_t * old = &label->lines;
+    if(old->starts == NULL) return false;
+
+    /*Start on the line before the edited one as a word from the edited line might fit there now.
+     *If a word continues on the next line, the line before that depends on the edited word too.*/
+    uint32_t first = lines_get_line_of_byte(label, byte_id);
+    if(first > 0) {
+        do {
+            first--;
+        } while(first > 0 && !lines_is_word_start(label->text, old->starts[first + 1]));
+    }
+
+    lv_label_lines_t lines = *old;
+    lines.starts = NULL;
+    lines.widths = NULL;
+    lines.cnt = 0;
+    lines.cap = 0;
+
+    bool ok = lines_reserve(&lines, old->cnt);
+    if(ok) {
+        lv_memcpy(lines.starts, old->starts, first * sizeof(uint32_t));
+        lv_memcpy(lines.widths, old->widths, first * sizeof(int32_t));
+        lines.cnt = first;
+        ok = lines_break(label, &lines, old->starts[first], old, first, byte_id + ins_len, del_len, ins_len, same_line);
+    }
+
+    lines_free(label);
+    if(ok) {
+        label->lines = lines;
+    }
+    else {
+        lv_free(lines.starts);
+        lv_free(lines.widths);
+    }
+
+    *first_line = first;
+    return ok;
+}
+
+/* Update the lines after an edit and redraw only the changed ones.
+ * Return false if the whole label needs to be refreshed. */
+static bool lines_edit(lv_obj_t * obj, uint32_t byte_id, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    int32_t line_h = lv_font_get_line_height(font) + line_space;
+    if(line_h <= 0 || !lines_match(label, font, lv_area_get_width(&txt_coords), letter_space, get_label_flags(label))) {
+        return false;
+    }
+
+    uint32_t old_cnt = label->lines.cnt;
+    uint32_t first_line;
+    uint32_t same_line;
+    if(!lines_update(obj, byte_id, del_len, ins_len, &first_line, &same_line)) return false;
+
+    label->hint.line_start = -1;
+    label->invalid_size_cache = true;
+    lv_obj_refresh_self_size(obj);
+
+    /*Redraw the changed lines. If the number of lines has changed the lines below moved too.*/
+    int32_t ext = lv_obj_get_ext_draw_size(obj);
+    lv_area_t inv_area;
+    inv_area.x1 = obj->coords.x1 - ext;
+    inv_area.x2 = obj->coords.x2 + ext;
+    inv_area.y1 = txt_coords.y1 + (int32_t)first_line * line_h - ext;
+    if(label->lines.cnt == old_cnt) inv_area.y2 = txt_coords.y1 + (int32_t)same_line * line_h + ext;
+    else inv_area.y2 = obj->coords.y2 + ext;
+    lv_obj_invalidate_area(obj, &inv_area);
+
+    return true;
+}
+
+/* Get the size of the text like `lv_text_get_size()` */
+static void lines_get_size(lv_label_t * label, lv_point_t * size, int32_t letter_height, int32_t line_space)
+{
+    lv_label_lines_t * lines = &label->lines;
+
+    size->x = 0;
+    uint32_t i;
+    for(i = 0; i < lines->cnt; i++) {
+        size->x = LV_MAX(size->x, lines->widths[i]);
+    }
+
+    uint32_t line_cnt = lines->cnt;
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    uint32_t end = lines->starts[lines->cnt];
+    if(end != 0 && (label->text[end - 1] == '\n' || label->text[end - 1] == '\r')) line_cnt++;
+
+    if(line_cnt == 0) size->y = letter_height;
+    else size->y = (int32_t)line_cnt * (letter_height + line_space) - line_space;
+}
+
+/* Get the index of the line on the `y` coordinate. It might be `lines.cnt` or larger below the last line. */
+static uint32_t lines_get_line_on(int32_t y, int32_t letter_height, int32_t line_space)
+{
+    if(y <= letter_height) return 0;
+
+    int32_t line_h = letter_height + line_space;
+    return (y - letter_height + line_h - 1) / line_h;
+}
+
+/* Get the index of the line containing `byte_id`. */
+static uint32_t lines_get_line_of_byte(lv_label_t * label, uint32_t byte_id)
+{
+    lv_label_lines_t * lines = &label->lines;
+    if(lines->cnt == 0) return 0;
+
+    /*Find the last line starting before `byte_id`*/
+    uint32_t min = 0;
+    uint32_t max = lines->cnt - 1;
+    while(min < max) {
+        uint32_t mid = (min + max + 1) / 2;
+        if(lines->starts[mid] <= byte_id) min = mid;
+        else max = mid - 1;
+    }
+
+    return min;
+}
+
+#endif /*LV_LABEL_LONG_TXT_HINT*/
+
 #endif
@@ -28,6 +28,20 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_LABEL_LONG_TXT_HINT
+/** Line breaks of a long text, kept to avoid processing the whole text on every refresh and redraw */
+typedef struct {
+    uint32_t * starts;          /**< Start index of every line and the length of the text at `starts[cnt]`*/
+    int32_t * widths;           /**< Width of every line as measured by `lv_text_get_width()`*/
+    uint32_t cnt;               /**< Number of lines*/
+    uint32_t cap;               /**< Number of lines the arrays have space for*/
+    const lv_font_t * font;     /**< The lines were broken with this font, width, letter space and flags*/
+    int32_t max_w;
+    int32_t letter_space;
+    lv_text_flag_t flag;
+} lv_label_lines_t;
+#endif
+
 struct _lv_label_t {
     lv_obj_t obj;
     char * text;
@@ -36,6 +50,7 @@ struct _lv_label_t {
 
 #if LV_LABEL_LONG_TXT_HINT
     lv_draw_label_hint_t hint;
+    lv_label_lines_t lines;
 #endif
 
 #if LV_LABEL_TEXT_SELECTION
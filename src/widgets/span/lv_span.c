@@ -36,6 +36,17 @@ typedef struct {
     int32_t letter_space;
 } lv_snippet_t;
 
+/** A line of the cached layout. Its runs are `layout_runs[run_start .. run_start + run_cnt - 1]`*/
+typedef struct {
+    uint32_t run_start;
+    uint32_t run_cnt;
+    int32_t y;              /**< Relative to the top of the content area*/
+    int32_t w;              /**< Width of the runs, with the indent on the first line*/
+    int32_t max_line_h;
+    int32_t max_baseline;
+    bool is_end_line;
+} layout_line_t;
+
 struct _snippet_stack {
     lv_snippet_t    stack[LV_SPAN_SNIPPET_STACK_SIZE];
     uint32_t        index;
@@ -58,6 +69,7 @@ static lv_blend_mode_t lv_span_get_style_text_blend_mode(lv_obj_t * par, lv_span
 static int32_t lv_span_get_style_text_decor(lv_obj_t * par, lv_span_t * span);
 
 static inline void span_text_check(const char ** text);
+static void layout_refresh(lv_obj_t * obj, int32_t max_width, int32_t max_height);
 static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer);
 static bool lv_text_get_snippet(const char * txt, const lv_font_t * font, int32_t letter_space,
                                 int32_t max_width, lv_text_flag_t flag, int32_t * use_width,
@@ -634,6 +646,9 @@ static void lv_spangroup_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     spans->cache_w = 0;
     spans->cache_h = 0;
     spans->refresh = 1;
+    lv_array_init(&spans->layout_runs, 0, sizeof(lv_snippet_t));
+    lv_array_init(&spans->layout_lines, 0, sizeof(layout_line_t));
+    spans->layout_valid = 0;
 }
 
 static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -651,6 +666,9 @@ static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
         lv_free(cur_span);
         cur_span = lv_ll_get_head(&spans->child_ll);
     }
+
+    lv_array_deinit(&spans->layout_runs);
+    lv_array_deinit(&spans->layout_lines);
 }
 
 static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -882,42 +900,34 @@ static int32_t convert_indent_pct(lv_obj_t * obj, int32_t width)
 }
 
 /**
- * draw span group
- * @param spans obj handle
- * @param coords coordinates of the label
- * @param mask the label will be drawn only in this area
+ * Break the texts of the spans into lines and save the text runs of each line.
+ * The glyphs are measured only here, drawing just replays the saved runs.
+ * @param obj           pointer to a spangroup
+ * @param max_width     width of the content area
+ * @param max_height    height of the content area
  */
-static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
+static void layout_refresh(lv_obj_t * obj, int32_t max_width, int32_t max_height)
 {
-
-    lv_area_t coords;
-    lv_obj_get_content_coords(obj, &coords);
-
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
 
-    /* return if not span */
+    lv_array_clear(&spans->layout_runs);
+    lv_array_clear(&spans->layout_lines);
+    spans->layout_w = max_width;
+    spans->layout_h = max_height;
+    /*Valid only if all the lines are saved, else it's refreshed again the next time*/
+    spans->layout_valid = 0;
+
     if(lv_ll_get_head(&spans->child_ll) == NULL) {
+        spans->layout_valid = 1;
         return;
     }
 
-    /* return if no draw area */
-    lv_area_t clip_area;
-    if(!lv_area_intersect(&clip_area, &coords, &layer->_clip_area))  return;
-    const lv_area_t clip_area_ori = layer->_clip_area;
-    layer->_clip_area = clip_area;
-
-    /* init draw variable */
+    /* init layout variable */
     lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);;
-    int32_t max_width = lv_area_get_width(&coords);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     int32_t indent = convert_indent_pct(obj, max_width);
     int32_t max_w  = max_width - indent; /* first line need minus indent */
-    lv_opa_t obj_opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    txt_pos.y = coords.y1;
-    txt_pos.x = coords.x1 + indent; /* first line need add indent */
+    int32_t line_y = 0;
 
     lv_span_t * cur_span = lv_ll_get_head(&spans->child_ll);
     const char * cur_txt = cur_span->txt;
@@ -926,14 +936,10 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
     lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
     lv_memzero(&snippet, sizeof(snippet));
 
-    lv_draw_label_dsc_t label_draw_dsc;
-    lv_draw_label_dsc_init(&label_draw_dsc);
-
     bool is_first_line = true;
-    /* the loop control how many lines need to draw */
+    /* the loop control how many lines need to layout */
     while(cur_span) {
         bool is_end_line = false;
-        bool ellipsis_valid = false;
         int32_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
         int32_t max_baseline = 0; /*baseline of the highest span*/
         lv_snippet_clear();
@@ -1022,29 +1028,106 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
                     next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
                 }
             }
-            if(txt_pos.y + max_line_h + next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
-                ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS;
+            if(line_y + max_line_h + next_line_h - line_space > max_height) { /* for overflow if is end line. */
                 is_end_line = true;
             }
         }
 
+        /* save the line and its runs */
+        layout_line_t line;
+        line.run_start = lv_array_size(&spans->layout_runs);
+        line.run_cnt = item_cnt;
+        line.y = line_y;
+        line.w = is_first_line ? indent : 0;
+        line.max_line_h = max_line_h;
+        line.max_baseline = max_baseline;
+        line.is_end_line = is_end_line;
+
+        uint32_t i;
+        for(i = 0; i < item_cnt; i++) {
+            lv_snippet_t * pinfo = lv_get_snippet(i);
+            line.w += pinfo->txt_w;
+            if(lv_array_push_back(&spans->layout_runs, pinfo) != LV_RESULT_OK) return;
+        }
+        line.w -= lv_get_snippet(item_cnt - 1)->letter_space;
+        if(lv_array_push_back(&spans->layout_lines, &line) != LV_RESULT_OK) return;
+
+        /* next line init */
+        is_first_line = false;
+        line_y += max_line_h;
+        if(is_end_line) {
+            break;
+        }
+        max_w = max_width;
+    }
+
+    spans->layout_valid = 1;
+}
+
+/**
+ * draw span group
+ * @param spans obj handle
+ * @param coords coordinates of the label
+ * @param mask the label will be drawn only in this area
+ */
+static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
+{
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+
+    /* return if not span */
+    if(lv_ll_get_head(&spans->child_ll) == NULL) {
+        return;
+    }
+
+    /* return if no draw area */
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, &coords, &layer->_clip_area))  return;
+
+    /* init draw variable */
+    int32_t max_width = lv_area_get_width(&coords);
+    int32_t max_height = lv_area_get_height(&coords);
+    if(!spans->layout_valid || spans->layout_w != max_width || spans->layout_h != max_height) {
+        layout_refresh(obj, max_width, max_height);
+    }
+
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    layer->_clip_area = clip_area;
+
+    int32_t indent = convert_indent_pct(obj, max_width);
+    lv_opa_t obj_opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
+    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
+
+    lv_draw_label_dsc_t label_draw_dsc;
+    lv_draw_label_dsc_init(&label_draw_dsc);
+
+    uint32_t line_cnt = lv_array_size(&spans->layout_lines);
+    uint32_t l;
+    for(l = 0; l < line_cnt; l++) {
+        const layout_line_t * line = lv_array_at(&spans->layout_lines, l);
+
+        /* coords of draw span-txt */
+        lv_point_t txt_pos;
+        txt_pos.x = coords.x1 + (l == 0 ? indent : 0); /* first line need add indent */
+        txt_pos.y = coords.y1 + line->y;
+
+        if(txt_pos.y > clip_area.y2 + 1) {
+            break;
+        }
+
         /*Go the first visible line*/
-        if(txt_pos.y + max_line_h < clip_area.y1) {
-            goto Next_line_init;
+        if(txt_pos.y + line->max_line_h < clip_area.y1) {
+            continue;
         }
 
+        bool ellipsis_valid = line->is_end_line && spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS;
+
         /* align deal with */
-        lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
         if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
-            int32_t align_ofs = 0;
-            int32_t txts_w = is_first_line ? indent : 0;
-            uint32_t i;
-            for(i = 0; i < item_cnt; i++) {
-                lv_snippet_t * pinfo = lv_get_snippet(i);
-                txts_w = txts_w + pinfo->txt_w;
-            }
-            txts_w -= lv_get_snippet(item_cnt - 1)->letter_space;
-            align_ofs = max_width > txts_w ? max_width - txts_w : 0;
+            int32_t align_ofs = max_width > line->w ? max_width - line->w : 0;
             if(align == LV_TEXT_ALIGN_CENTER) {
                 align_ofs = align_ofs >> 1;
             }
@@ -1053,15 +1136,15 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
 
         /* draw line letters */
         uint32_t i;
-        for(i = 0; i < item_cnt; i++) {
-            lv_snippet_t * pinfo = lv_get_snippet(i);
+        for(i = 0; i < line->run_cnt; i++) {
+            const lv_snippet_t * pinfo = lv_array_at(&spans->layout_runs, line->run_start + i);
 
             /* bidi deal with:todo */
             const char * bidi_txt = pinfo->txt;
 
             lv_point_t pos;
             pos.x = txt_pos.x;
-            pos.y = txt_pos.y + max_line_h - pinfo->line_h - (max_baseline - pinfo->font->base_line);
+            pos.y = txt_pos.y + line->max_line_h - pinfo->line_h - (line->max_baseline - pinfo->font->base_line);
             label_draw_dsc.color = lv_span_get_style_text_color(obj, pinfo->span);
             label_draw_dsc.opa = lv_span_get_style_text_opa(obj, pinfo->span);
             label_draw_dsc.font = lv_span_get_style_text_font(obj, pinfo->span);
@@ -1094,9 +1177,10 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
 
                 label_draw_dsc.flag = LV_TEXT_FLAG_BREAK_ALL;
                 uint32_t next_ofs;
+                int32_t txt_w;
                 need_draw_ellipsis = lv_text_get_snippet(pinfo->txt, pinfo->font, pinfo->letter_space, coords.x2 - a.x1 - dot_width,
-                                                         label_draw_dsc.flag, &pinfo->txt_w, &next_ofs);
-                a.x2 = a.x1 + pinfo->txt_w;
+                                                         label_draw_dsc.flag, &txt_w, &next_ofs);
+                a.x2 = a.x1 + txt_w;
                 label_draw_dsc.text_length = next_ofs + 1;
             }
 
@@ -1111,17 +1195,6 @@ static void lv_draw_span(lv_obj_t * obj, lv_layer_t * layer)
 
             txt_pos.x = a.x2;
         }
-
-Next_line_init:
-        /* next line init */
-        is_first_line = false;
-        txt_pos.x = coords.x1;
-        txt_pos.y += max_line_h;
-        if(is_end_line || txt_pos.y > clip_area.y2 + 1) {
-            layer->_clip_area = clip_area_ori;
-            return;
-        }
-        max_w = max_width;
     }
     layer->_clip_area = clip_area_ori;
 }
@@ -1130,6 +1203,7 @@ static void refresh_self_size(lv_obj_t * obj)
 {
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
     spans->refresh = 1;
+    spans->layout_valid = 0;
     lv_obj_invalidate(obj);
     lv_obj_refresh_self_size(obj);
 }
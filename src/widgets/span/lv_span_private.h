@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "../../core/lv_obj_private.h"
+#include "../../misc/lv_array.h"
 #include "lv_span.h"
 
 #if LV_USE_SPAN != 0
@@ -45,9 +46,14 @@ struct _lv_spangroup_t {
     int32_t cache_w;        /**<  the cache automatically calculates the width */
     int32_t cache_h;        /**<  similar cache_w */
     lv_ll_t  child_ll;
+    lv_array_t layout_runs;     /**<  the cached text runs of all lines, drawn without measuring the text again */
+    lv_array_t layout_lines;    /**<  the cached lines, each one refers to a range of `layout_runs` */
+    int32_t layout_w;           /**<  the content width used for the cached layout */
+    int32_t layout_h;           /**<  the content height used for the cached layout */
     uint32_t mode : 2;      /**<  details see lv_span_mode_t */
     uint32_t overflow : 1;  /**<  details see lv_span_overflow_t */
     uint32_t refresh : 1;   /**<  the spangroup need refresh cache_w and cache_h */
+    uint32_t layout_valid : 1;  /**<  the layout is up to date with the texts and styles */
 };
 
 
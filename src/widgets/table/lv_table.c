@@ -40,8 +40,16 @@ static void draw_main(lv_event_t * e);
 static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t * font,
                               int32_t letter_space, int32_t line_space,
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom);
+static int32_t get_row_height_estimate(lv_obj_t * obj);
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row);
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col);
+static bool refr_visible_rows(lv_obj_t * obj);
+static void get_visible_rows(lv_obj_t * obj, uint32_t * first, uint32_t * last);
+static void row_h_sum_build(lv_table_t * table, uint32_t start_row);
+static int32_t row_h_sum_get(const lv_table_t * table, uint32_t row);
+static void row_h_set(lv_table_t * table, uint32_t row, int32_t h);
+static uint32_t row_h_find(const lv_table_t * table, int32_t y);
+static const char * get_cell_text(lv_obj_t * obj, uint32_t row, uint32_t col);
 static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
 static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
@@ -53,6 +61,18 @@ static inline bool is_cell_empty(void * cell)
     return cell == NULL;
 }
 
+static inline bool is_row_h_valid(const lv_table_t * table, uint32_t row)
+{
+    return !table->is_virtual || (table->row_h_valid[row >> 3] & (1 << (row & 0x7)));
+}
+
+static inline void set_row_h_valid(lv_table_t * table, uint32_t row, bool valid)
+{
+    if(!table->is_virtual) return;
+    if(valid) table->row_h_valid[row >> 3] |= (uint8_t)(1 << (row & 0x7));
+    else table->row_h_valid[row >> 3] &= (uint8_t)~(1 << (row & 0x7));
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -215,6 +235,16 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    table->row_h_sum = lv_realloc(table->row_h_sum, (table->row_cnt + 1) * sizeof(table->row_h_sum[0]));
+    LV_ASSERT_MALLOC(table->row_h_sum);
+    if(table->row_h_sum == NULL) return;
+
+    if(table->is_virtual) {
+        table->row_h_valid = lv_realloc(table->row_h_valid, (table->row_cnt + 7) / 8);
+        LV_ASSERT_MALLOC(table->row_h_valid);
+        if(table->row_h_valid == NULL) return;
+    }
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
         uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
@@ -240,7 +270,8 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
         lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
     }
 
-    refr_size_form_row(obj, 0);
+    /*The height of the remaining rows haven't changed*/
+    refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
 }
 
 void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
@@ -414,6 +445,36 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
     }
 }
 
+void lv_table_set_virtual(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->is_virtual == en) return;
+
+    if(en) {
+        table->row_h_valid = lv_malloc((table->row_cnt + 7) / 8);
+        LV_ASSERT_MALLOC(table->row_h_valid);
+        if(table->row_h_valid == NULL) return;
+    }
+    else {
+        lv_free(table->row_h_valid);
+        table->row_h_valid = NULL;
+    }
+
+    table->is_virtual = en;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    table->cell_value_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -427,11 +488,17 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
-    uint32_t cell = row * table->col_cnt + col;
 
-    if(is_cell_empty(table->cell_data[cell])) return "";
+    const char * txt = get_cell_text(obj, row, col);
+    return txt ? txt : "";
+}
+
+bool lv_table_get_virtual(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    return table->cell_data[cell]->txt;
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->is_virtual;
 }
 
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
@@ -519,6 +586,8 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_h_sum = lv_malloc((table->row_cnt + 1) * sizeof(table->row_h_sum[0]));
+    row_h_sum_build(table, 0);
     table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     table->cell_data[0] = NULL;
 
@@ -544,6 +613,8 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
+    if(table->row_h_sum) lv_free(table->row_h_sum);
+    if(table->row_h_valid) lv_free(table->row_h_valid);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -570,12 +641,18 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = row_h_sum_get(table, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
     }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        /*Measure the rows which got close to the visible area*/
+        if(table->is_virtual && refr_visible_rows(obj)) {
+            lv_obj_refresh_self_size(obj);
+            lv_obj_invalidate(obj);
+        }
+    }
     else if(code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
         uint32_t col;
         uint32_t row;
@@ -705,16 +782,20 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Skip the rows above the clip area*/
+    int32_t y_start = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    uint32_t row_start = row_h_find(table, clip_area.y1 - y_start);
+    uint32_t cell = row_start * table->col_cnt;
+
+    cell_area.y2 = y_start + row_h_sum_get(table, row_start) - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
+    for(row = row_start; row < table->row_cnt; row++) {
         int32_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -811,7 +892,8 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = get_cell_text(obj, row, col);
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -828,7 +910,7 @@ static void draw_main(lv_event_t * e)
                 bool crop = ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP;
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
 
-                lv_text_get_size(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font,
+                lv_text_get_size(&txt_size, txt, label_dsc_def.font,
                                  label_dsc_act.letter_space, label_dsc_act.line_space,
                                  lv_area_get_width(&txt_area), txt_flags);
 
@@ -843,7 +925,10 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
+                    /*The text of the callback can be reused for the next cell so copy it*/
+                    label_dsc_act.text_local = is_cell_empty(table->cell_data[cell]) ||
+                                               txt != table->cell_data[cell]->txt;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -874,18 +959,36 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 
     lv_table_t * table = (lv_table_t *)obj;
     uint32_t i;
-    for(i = start_row; i < table->row_cnt; i++) {
-        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
-                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
-        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+    if(table->is_virtual) {
+        /*Only estimate the heights here, the rows around the visible area are measured below*/
+        int32_t h_est = get_row_height_estimate(obj);
+        for(i = start_row; i < table->row_cnt; i++) {
+            table->row_h[i] = h_est;
+            set_row_h_valid(table, i, false);
+        }
     }
+    else {
+        for(i = start_row; i < table->row_cnt; i++) {
+            int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+        }
+    }
+
+    row_h_sum_build(table, start_row);
+    if(table->is_virtual) refr_visible_rows(obj);
 
     lv_obj_refresh_self_size(obj);
     lv_obj_invalidate(obj);
 }
 
-static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
+/* Measure the rows around the visible area which have only estimated height.
+ * Return true if a height has changed. */
+static bool refr_visible_rows(lv_obj_t * obj)
 {
+    lv_table_t * table = (lv_table_t *)obj;
+    if(!table->is_virtual || table->row_cnt == 0) return false;
+
     const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
     const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
     const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -898,12 +1001,161 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
     const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
+    bool changed = false;
+    uint32_t first;
+    uint32_t last;
+    get_visible_rows(obj, &first, &last);
+
+    uint32_t i;
+    for(i = first; i <= last; i++) {
+        if(is_row_h_valid(table, i)) continue;
+
+        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+        calculated_height = LV_CLAMP(minh, calculated_height, maxh);
+        set_row_h_valid(table, i, true);
+        if(calculated_height != table->row_h[i]) {
+            row_h_set(table, i, calculated_height);
+            changed = true;
+            /*The rows might have moved out from the window, update it*/
+            get_visible_rows(obj, &first, &last);
+        }
+    }
+
+    return changed;
+}
+
+/* Get the range of rows in the visible area extended by the height of the table upwards and downwards */
+static void get_visible_rows(lv_obj_t * obj, uint32_t * first, uint32_t * last)
+{
     lv_table_t * table = (lv_table_t *)obj;
-    int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
-                                               cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
 
+    int32_t h = lv_obj_get_content_height(obj);
+    int32_t y = lv_obj_get_scroll_y(obj) - lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+
+    *first = row_h_find(table, y - h);
+    *last = row_h_find(table, y + 2 * h);
+    if(*first >= table->row_cnt) *first = table->row_cnt - 1;
+    if(*last >= table->row_cnt) *last = table->row_cnt - 1;
+}
+
+/* The height of a row with a single line of text */
+static int32_t get_row_height_estimate(lv_obj_t * obj)
+{
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    return LV_CLAMP(minh, lv_font_get_line_height(font) + cell_pad_top + cell_pad_bottom, maxh);
+}
+
+/* Rebuild the Fenwick tree of the row heights from `start_row`. The nodes before it must be valid. */
+static void row_h_sum_build(lv_table_t * table, uint32_t start_row)
+{
+    table->row_h_sum[0] = 0;
+
+    /*Node `i` stores the sum of the heights of the rows [i - lowbit(i), i - 1]*/
+    uint32_t i;
+    for(i = start_row + 1; i <= table->row_cnt; i++) {
+        uint32_t lowbit = i & (~i + 1);
+        table->row_h_sum[i] = table->row_h[i - 1] + row_h_sum_get(table, i - 1) - row_h_sum_get(table, i - lowbit);
+    }
+}
+
+/* Get the sum of the heights of the rows before `row` */
+static int32_t row_h_sum_get(const lv_table_t * table, uint32_t row)
+{
+    int32_t sum = 0;
+    while(row > 0) {
+        sum += table->row_h_sum[row];
+        row &= row - 1;
+    }
+
+    return sum;
+}
+
+static void row_h_set(lv_table_t * table, uint32_t row, int32_t h)
+{
+    int32_t diff = h - table->row_h[row];
+    table->row_h[row] = h;
+
+    uint32_t i;
+    for(i = row + 1; i <= table->row_cnt; i += i & (~i + 1)) {
+        table->row_h_sum[i] += diff;
+    }
+}
+
+/* Get the row at `y` relative to the top of the first row. Return `row_cnt` if `y` is below the last row. */
+static uint32_t row_h_find(const lv_table_t * table, int32_t y)
+{
+    if(y < 0 || table->row_cnt == 0) return 0;
+
+    uint32_t step = 1;
+    while(step <= table->row_cnt / 2) step <<= 1;
+
+    uint32_t pos = 0;
+    for(; step > 0; step >>= 1) {
+        if(pos + step <= table->row_cnt && table->row_h_sum[pos + step] <= y) {
+            pos += step;
+            y -= table->row_h_sum[pos];
+        }
+    }
+
+    return pos;
+}
+
+/* Get the stored text of a cell or the text of `cell_value_cb` if there is no stored text.
+ * Return NULL if the cell has no text at all. */
+static const char * get_cell_text(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    lv_table_cell_t * cell_data = table->cell_data[row * table->col_cnt + col];
+
+    if(!is_cell_empty(cell_data) && cell_data->txt[0] != '\0') return cell_data->txt;
+
+    if(table->cell_value_cb) {
+        const char * txt = table->cell_value_cb(obj, row, col);
+        if(txt) return txt;
+    }
+
+    return is_cell_empty(cell_data) ? NULL : cell_data->txt;
+}
+
+static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    lv_table_t * table = (lv_table_t *)obj;
     int32_t prev_row_size = table->row_h[row];
-    table->row_h[row] = LV_CLAMP(minh, calculated_height, maxh);
+
+    /*In virtual mode measure the row only if it's close to the visible area*/
+    uint32_t first = 0;
+    uint32_t last = table->row_cnt - 1;
+    if(table->is_virtual) get_visible_rows(obj, &first, &last);
+
+    if(row >= first && row <= last) {
+        int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
+                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+        row_h_set(table, row, LV_CLAMP(minh, calculated_height, maxh));
+        set_row_h_valid(table, row, true);
+    }
+    else {
+        row_h_set(table, row, get_row_height_estimate(obj));
+        set_row_h_valid(table, row, false);
+    }
 
     /*If the row height haven't changed invalidate only this cell*/
     if(prev_row_size == table->row_h[row]) {
@@ -933,8 +1185,9 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     uint32_t col;
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
         lv_table_cell_t * cell_data = table->cell_data[cell];
+        const char * txt = get_cell_text(obj, row_id, col);
 
-        if(is_cell_empty(cell_data)) {
+        if(txt == NULL) {
             continue;
         }
 
@@ -958,7 +1211,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             }
         }
 
-        lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) cell_data->ctrl;
+        lv_table_cell_ctrl_t ctrl = is_cell_empty(cell_data) ? 0 : (lv_table_cell_ctrl_t) cell_data->ctrl;
 
         /*When cropping the text we can assume the row height is equal to the line height*/
         if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
@@ -970,7 +1223,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             lv_point_t txt_size;
             txt_w -= cell_left + cell_right;
 
-            lv_text_get_size(&txt_size, table->cell_data[cell]->txt, font,
+            lv_text_get_size(&txt_size, txt, font,
                              letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
             h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
@@ -1022,13 +1275,7 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) break;
-        }
+        *row = row_h_find(table, y);
     }
 
     return LV_RESULT_OK;
@@ -1081,12 +1328,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = row_h_sum_get(table, row);
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
     area->y2 = area->y1 + table->row_h[row] - 1;
@@ -42,6 +42,12 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Get the text of a cell which has no text stored in the table.
+ * The returned text needs to be valid only until the next call, return NULL if the cell is empty.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 /**********************
@@ -140,6 +146,25 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
  */
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Enable or disable the virtual mode. In virtual mode only the rows around the visible area are measured
+ * (one viewport above and below) and the other rows have the default height (one line) until they get
+ * close to the visible area. It makes adding rows and scrolling fast in tables with fixed height
+ * and many rows.
+ * @param obj       pointer to a Table object
+ * @param en        true: enable the virtual mode; false: measure all the rows
+ */
+void lv_table_set_virtual(lv_obj_t * obj, bool en);
+
+/**
+ * Set a callback to provide the text of the cells without stored text.
+ * This way the texts don't need to be copied into the table.
+ * Call it again to refresh the table if the provided data has changed.
+ * @param obj       pointer to a Table object
+ * @param cb        the callback, or NULL to use only the stored texts
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -153,6 +178,13 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
+/**
+ * Get whether the virtual mode is enabled.
+ * @param obj       pointer to a Table object
+ * @return          true: the virtual mode is enabled
+ */
+bool lv_table_get_virtual(lv_obj_t * obj);
+
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
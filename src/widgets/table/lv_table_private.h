@@ -41,9 +41,13 @@ struct _lv_table_t {
     uint32_t row_cnt;
     lv_table_cell_t ** cell_data;
     int32_t * row_h;
+    int32_t * row_h_sum;    /**< Fenwick tree of `row_h` to get the rows by y coordinate in O(log n)*/
+    uint8_t * row_h_valid;  /**< In virtual mode a bit for each row, set if the row is measured*/
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_cell_value_cb_t cell_value_cb;
+    uint8_t is_virtual : 1;
 };
 
 
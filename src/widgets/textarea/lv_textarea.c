@@ -330,13 +330,8 @@ void lv_textarea_delete_char(lv_obj_t * obj)
     lv_result_t res = insert_handler(obj, del_buf);
     if(res != LV_RESULT_OK) return;
 
-    char * label_txt = lv_label_get_text(ta->label);
-
-    /*Delete a character*/
-    lv_text_cut(label_txt, ta->cursor.pos - 1, 1);
-
-    /*Refresh the label*/
-    lv_label_set_text(ta->label, label_txt);
+    /*Delete a character. Only the lines around it are refreshed.*/
+    lv_label_cut_text(ta->label, ta->cursor.pos - 1, 1);
     lv_textarea_clear_selection(obj);
 
     /*If the textarea became empty, invalidate it to hide the placeholder*/
@@ -1036,7 +1031,7 @@ static void label_event_cb(lv_event_t * e)
     lv_obj_t * ta = lv_obj_get_parent(label);
 
     if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED) {
-        lv_label_set_text(label, NULL);
+        /*The label has already refreshed its text*/
         refr_cursor_area(ta);
         start_cursor_blink(ta);
     }
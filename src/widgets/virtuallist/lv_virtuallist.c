@@ -0,0 +1,361 @@
+/**
+ * @file lv_virtuallist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_virtuallist_private.h"
+#include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_class_private.h"
+
+#if LV_USE_VIRTUALLIST
+
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_virtuallist_class)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_virtuallist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_virtuallist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_virtuallist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void refr_pool(lv_obj_t * obj, bool force);
+static bool remove_deleted_items(lv_obj_t * obj);
+static void refr_items(lv_obj_t * obj, bool force);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const lv_obj_class_t lv_virtuallist_class  = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = lv_virtuallist_constructor,
+    .destructor_cb = lv_virtuallist_destructor,
+    .event_cb = lv_virtuallist_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_virtuallist_t),
+    .name = "virtuallist",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_virtuallist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_virtuallist_set_item_cb(lv_obj_t * obj, lv_virtuallist_create_cb_t create_cb,
+                                lv_virtuallist_bind_cb_t bind_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+
+    /*The current items might be different so create them again.
+     *Empty the pool first to not handle the deleted items in LV_EVENT_CHILD_DELETED*/
+    if(list->create_cb != create_cb) {
+        uint32_t pool_cnt = list->pool_cnt;
+        list->pool_cnt = 0;
+        uint32_t i;
+        for(i = 0; i < pool_cnt; i++) lv_obj_delete(list->items[i]);
+    }
+
+    list->create_cb = create_cb;
+    list->bind_cb = bind_cb;
+    refr_pool(obj, true);
+}
+
+void lv_virtuallist_set_item_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    if(list->item_cnt == cnt) return;
+
+    list->item_cnt = cnt;
+    /*Move the items into the new range first, else they would keep the old scroll range*/
+    refr_pool(obj, true);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_update_layout(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+}
+
+void lv_virtuallist_set_item_height(lv_obj_t * obj, int32_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    if(h < 1) h = 1;
+    if(list->item_h == h) return;
+
+    list->item_h = h;
+    /*Move the items into the new range first, else they would keep the old scroll range*/
+    refr_pool(obj, true);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_update_layout(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+}
+
+void lv_virtuallist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    refr_items(obj, true);
+}
+
+void lv_virtuallist_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    if(index >= list->item_cnt) return;
+
+    int32_t y = (int32_t)index * list->item_h;
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+    int32_t content_h = lv_obj_get_content_height(obj);
+
+    /*Scroll only as much as needed to make the item fully visible*/
+    if(y < scroll_y) lv_obj_scroll_to_y(obj, y, anim_en);
+    else if(y + list->item_h > scroll_y + content_h) lv_obj_scroll_to_y(obj, y + list->item_h - content_h, anim_en);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_virtuallist_get_item_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    return list->item_cnt;
+}
+
+int32_t lv_virtuallist_get_item_height(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    return list->item_h;
+}
+
+lv_obj_t * lv_virtuallist_get_item(lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    if(list->pool_cnt == 0 || index >= list->item_cnt) return NULL;
+
+    uint32_t slot = index % list->pool_cnt;
+    if(list->item_ids[slot] != index) return NULL;
+
+    return list->items[slot];
+}
+
+uint32_t lv_virtuallist_get_item_index(lv_obj_t * obj, lv_obj_t * item)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    uint32_t i;
+    for(i = 0; i < list->pool_cnt; i++) {
+        if(list->items[i] == item) return list->item_ids[i];
+    }
+
+    return LV_VIRTUALLIST_ITEM_NONE;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_virtuallist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    list->item_h = LV_DPI_DEF / 3;
+
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_virtuallist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    /*The items are deleted as children*/
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    lv_free(list->items);
+    lv_free(list->item_ids);
+    list->items = NULL;
+    list->item_ids = NULL;
+    list->pool_cnt = 0;
+}
+
+static void lv_virtuallist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_result_t res;
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*The scrollable area is given by the items of the data source, not by the children*/
+        lv_point_t * p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, (int32_t)list->item_cnt * list->item_h);
+    }
+    else if(code == LV_EVENT_SCROLL) {
+        refr_items(obj, false);
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        /*Also sent on every state change (e.g. scrolled), so bind only the new indices*/
+        refr_pool(obj, false);
+    }
+    else if(code == LV_EVENT_CHILD_DELETED) {
+        /*Items might be deleted or moved by the application too, e.g. by `lv_obj_clean()`*/
+        if(remove_deleted_items(obj)) refr_pool(obj, true);
+    }
+}
+
+/* Create or delete items to have just enough of them to cover the list, and bind them.
+ * If `force` is true, or the number of items changed, all items are resized and bound again. */
+static void refr_pool(lv_obj_t * obj, bool force)
+{
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+
+    uint32_t pool_cnt = 0;
+    if(list->create_cb && list->item_cnt > 0) {
+        /*+2: partially visible items on the top and bottom*/
+        pool_cnt = lv_obj_get_height(obj) / list->item_h + 2;
+        pool_cnt = LV_MIN(pool_cnt, list->item_cnt);
+    }
+
+    uint32_t old_pool_cnt = list->pool_cnt;
+    uint32_t i;
+    if(pool_cnt < old_pool_cnt) {
+        /*Remove them from the pool first to not handle them in LV_EVENT_CHILD_DELETED*/
+        list->pool_cnt = pool_cnt;
+        for(i = pool_cnt; i < old_pool_cnt; i++) lv_obj_delete(list->items[i]);
+    }
+
+    if(pool_cnt != old_pool_cnt) {
+        /*Store each array as soon as it's reallocated as the old one might be freed already*/
+        lv_obj_t ** items = lv_realloc(list->items, pool_cnt * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(items);
+        if(items == NULL) return;
+        list->items = items;
+
+        uint32_t * item_ids = lv_realloc(list->item_ids, pool_cnt * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(item_ids);
+        if(item_ids == NULL) return;
+        list->item_ids = item_ids;
+    }
+
+    for(i = old_pool_cnt; i < pool_cnt; i++) {
+        lv_obj_t * item = list->create_cb(obj);
+        LV_ASSERT_NULL(item);
+        list->items[i] = item;
+        list->item_ids[i] = LV_VIRTUALLIST_ITEM_NONE;
+    }
+
+    /*The items map to different indices now, bind all of them*/
+    if(pool_cnt != old_pool_cnt) force = true;
+    list->pool_cnt = pool_cnt;
+
+    if(force) {
+        for(i = 0; i < pool_cnt; i++) {
+            lv_obj_set_size(list->items[i], lv_pct(100), list->item_h);
+        }
+    }
+
+    refr_items(obj, force);
+}
+
+/* Remove the items from the pool which are not children of the list anymore.
+ * Return true if an item was removed. */
+static bool remove_deleted_items(lv_obj_t * obj)
+{
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    uint32_t pool_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < list->pool_cnt; i++) {
+        /*The deleted items can't be dereferenced, so look for them among the children*/
+        uint32_t c;
+        for(c = 0; c < child_cnt; c++) {
+            if(lv_obj_get_child(obj, (int32_t)c) == list->items[i]) break;
+        }
+        if(c == child_cnt) continue;
+
+        list->items[pool_cnt] = list->items[i];
+        list->item_ids[pool_cnt] = list->item_ids[i];
+        pool_cnt++;
+    }
+
+    if(pool_cnt == list->pool_cnt) return false;
+
+    list->pool_cnt = pool_cnt;
+    return true;
+}
+
+/* Bind the items of the pool to the indices around the visible area */
+static void refr_items(lv_obj_t * obj, bool force)
+{
+    lv_virtuallist_t * list = (lv_virtuallist_t *)obj;
+    if(list->pool_cnt == 0) return;
+
+    int32_t y = lv_obj_get_scroll_y(obj) - lv_obj_get_style_pad_top(obj, LV_PART_MAIN) -
+                lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    uint32_t first = y > 0 ? (uint32_t)(y / list->item_h) : 0;
+
+    /*Keep the whole pool in the range of the items*/
+    if(first + list->pool_cnt > list->item_cnt) first = list->item_cnt - list->pool_cnt;
+
+    uint32_t i;
+    for(i = first; i < first + list->pool_cnt; i++) {
+        uint32_t slot = i % list->pool_cnt;
+        if(!force && list->item_ids[slot] == i) continue;
+
+        lv_obj_t * item = list->items[slot];
+        list->item_ids[slot] = i;
+        lv_obj_set_y(item, (int32_t)i * list->item_h);
+        if(list->bind_cb) list->bind_cb(obj, item, i);
+    }
+}
+
+#endif /*LV_USE_VIRTUALLIST*/
@@ -0,0 +1,140 @@
+/**
+ * @file lv_virtuallist.h
+ *
+ */
+
+#ifndef LV_VIRTUALLIST_H
+#define LV_VIRTUALLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../core/lv_obj.h"
+
+#if LV_USE_VIRTUALLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_VIRTUALLIST_ITEM_NONE 0xFFFFFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create a new item on the virtual list. The item needs to be created as a child of `obj`.
+ * Its width and height will be set by the list.
+ */
+typedef lv_obj_t * (*lv_virtuallist_create_cb_t)(lv_obj_t * obj);
+
+/**
+ * Update the content of an `item` to show the `index`-th item of the data source.
+ */
+typedef void (*lv_virtuallist_bind_cb_t)(lv_obj_t * obj, lv_obj_t * item, uint32_t index);
+
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_virtuallist_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtual list object
+ * @param parent    pointer to an object, it will be the parent of the new virtual list
+ * @return          pointer to the created virtual list
+ */
+lv_obj_t * lv_virtuallist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the callbacks to create and fill the items.
+ * Only as many items are created as many fit into the list, and they are
+ * bound to other indices while scrolling.
+ * @param obj           pointer to a virtual list object
+ * @param create_cb     called to create a new item
+ * @param bind_cb       called to show the data of an index on an item
+ */
+void lv_virtuallist_set_item_cb(lv_obj_t * obj, lv_virtuallist_create_cb_t create_cb,
+                                lv_virtuallist_bind_cb_t bind_cb);
+
+/**
+ * Set the number of items in the data source
+ * @param obj       pointer to a virtual list object
+ * @param cnt       number of items
+ */
+void lv_virtuallist_set_item_count(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the height of the items. All items have the same height.
+ * @param obj       pointer to a virtual list object
+ * @param h         height of an item in pixels
+ */
+void lv_virtuallist_set_item_height(lv_obj_t * obj, int32_t h);
+
+/**
+ * Bind all the visible items again, e.g. if the data has changed.
+ * @param obj       pointer to a virtual list object
+ */
+void lv_virtuallist_refresh(lv_obj_t * obj);
+
+/**
+ * Scroll to make an item visible
+ * @param obj       pointer to a virtual list object
+ * @param index     index of the item
+ * @param anim_en   LV_ANIM_ON: scroll with animation
+ */
+void lv_virtuallist_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of items in the data source
+ * @param obj       pointer to a virtual list object
+ * @return          number of items
+ */
+uint32_t lv_virtuallist_get_item_count(lv_obj_t * obj);
+
+/**
+ * Get the height of the items
+ * @param obj       pointer to a virtual list object
+ * @return          height of an item
+ */
+int32_t lv_virtuallist_get_item_height(lv_obj_t * obj);
+
+/**
+ * Get the object showing an item
+ * @param obj       pointer to a virtual list object
+ * @param index     index of the item
+ * @return          the object bound to `index` or NULL if the item is not around the visible area
+ */
+lv_obj_t * lv_virtuallist_get_item(lv_obj_t * obj, uint32_t index);
+
+/**
+ * Get the index of the item shown by an object, e.g. in the event handler of an item.
+ * @param obj       pointer to a virtual list object
+ * @param item      an object created by `create_cb`
+ * @return          the index bound to `item` or `LV_VIRTUALLIST_ITEM_NONE`
+ */
+uint32_t lv_virtuallist_get_item_index(lv_obj_t * obj, lv_obj_t * item);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VIRTUALLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VIRTUALLIST_H*/
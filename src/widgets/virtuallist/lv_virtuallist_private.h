@@ -0,0 +1,57 @@
+/**
+ * @file lv_virtuallist_private.h
+ *
+ */
+
+#ifndef LV_VIRTUALLIST_PRIVATE_H
+#define LV_VIRTUALLIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_virtuallist.h"
+
+#if LV_USE_VIRTUALLIST
+#include "../../core/lv_obj_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Data of virtual list */
+struct _lv_virtuallist_t {
+    lv_obj_t obj;
+    lv_virtuallist_create_cb_t create_cb;
+    lv_virtuallist_bind_cb_t bind_cb;
+    lv_obj_t ** items;      /**< The pool of item objects. Index `i` is shown by `items[i % pool_cnt]`*/
+    uint32_t * item_ids;    /**< The index bound to each item of the pool or `LV_VIRTUALLIST_ITEM_NONE`*/
+    uint32_t pool_cnt;
+    uint32_t item_cnt;      /**< Number of items in the data source*/
+    int32_t item_h;
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_VIRTUALLIST */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VIRTUALLIST_PRIVATE_H*/
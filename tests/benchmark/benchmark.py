@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+"""
+Build and run the headless benchmark with different number of draw units
+and merge the results into a single JSON file.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+benchmark_dir = os.path.dirname(os.path.realpath(__file__))
+
+
+def build(build_dir, draw_unit_cnt):
+    subprocess.check_call(['cmake', '-S', benchmark_dir, '-B', build_dir,
+                           '-DCMAKE_BUILD_TYPE=Release',
+                           '-DBENCHMARK_DRAW_UNIT_CNT=%d' % draw_unit_cnt])
+    subprocess.check_call(['cmake', '--build', build_dir, '--parallel', str(os.cpu_count() or 1)])
+
+
+def run(build_dir, frame_cnt):
+    out_path = os.path.join(build_dir, 'benchmark.json')
+    subprocess.check_call([os.path.join(build_dir, 'lvgl_benchmark'),
+                           '--frames', str(frame_cnt), '--output', out_path])
+    with open(out_path) as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run lv_demo_benchmark headless and save the results as JSON.')
+    parser.add_argument('--draw-units', type=int, nargs='+', default=[1, 2, 4],
+                        help='number of software draw units to test with (default: 1 2 4)')
+    parser.add_argument('--frames', type=int, default=300,
+                        help='number of measured frames per scene (default: 300)')
+    parser.add_argument('--build-dir', default=os.path.join(benchmark_dir, 'build'),
+                        help='directory for the builds')
+    parser.add_argument('--output', default='benchmark.json',
+                        help='the merged JSON file (default: benchmark.json)')
+    args = parser.parse_args()
+
+    runs = []
+    for draw_unit_cnt in args.draw_units:
+        build_dir = os.path.join(args.build_dir, 'draw_units_%d' % draw_unit_cnt)
+        build(build_dir, draw_unit_cnt)
+        runs.append(run(build_dir, args.frames))
+
+    with open(args.output, 'w') as f:
+        json.dump({'lvgl_version': runs[0]['lvgl_version'], 'runs': runs}, f, indent=2)
+
+    print('Results of %d run(s) saved to %s' % (len(runs), args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
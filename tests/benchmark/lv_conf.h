@@ -0,0 +1,62 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the headless benchmark.
+ * Only the settings differing from the defaults are listed.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH          32
+
+/*The benchmark is measured with virtual time, a frame is rendered in every period*/
+#define LV_DEF_REFR_PERIOD      16
+
+/*Use the built-in heap to measure the peak memory usage*/
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE             (16 * 1024 * 1024)
+
+#define LV_USE_OS               LV_OS_PTHREAD
+
+/*Set from CMake to compare different number of draw units*/
+#ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+#endif
+
+#define LV_USE_LOG              1
+#define LV_LOG_LEVEL            LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF           1
+
+/*Only the tick source of the built-in profiler is used to measure the frames in microseconds*/
+#define LV_USE_PROFILER                 1
+#define LV_USE_PROFILER_BUILTIN         1
+#define LV_PROFILER_BUILTIN_BUF_SIZE    1024
+#define LV_PROFILER_INCLUDE             "src/misc/lv_profiler_builtin.h"
+#define LV_PROFILER_LAYOUT              0
+#define LV_PROFILER_REFR                0
+#define LV_PROFILER_DRAW                0
+#define LV_PROFILER_INDEV               0
+#define LV_PROFILER_DECODER             0
+#define LV_PROFILER_FONT                0
+#define LV_PROFILER_FS                  0
+#define LV_PROFILER_STYLE               0
+#define LV_PROFILER_TIMER               0
+#define LV_PROFILER_CACHE               0
+
+#define LV_USE_SYSMON                   1
+#define LV_SYSMON_FRAME_STATS_CNT       4
+
+#define LV_FONT_MONTSERRAT_12   1
+#define LV_FONT_MONTSERRAT_14   1
+#define LV_FONT_MONTSERRAT_16   1
+#define LV_FONT_MONTSERRAT_18   1
+#define LV_FONT_MONTSERRAT_20   1
+#define LV_FONT_MONTSERRAT_24   1
+#define LV_FONT_MONTSERRAT_26   1
+
+#define LV_USE_DEMO_WIDGETS     1
+#define LV_USE_DEMO_BENCHMARK   1
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,283 @@
+/**
+ * @file main.c
+ * Run the scenes of `lv_demo_benchmark` headless for a fixed number of frames and save the results as JSON.
+ *
+ * The scenes are measured on a display with a memory flush. Time is virtual: before every frame the
+ * tick is advanced by `LV_DEF_REFR_PERIOD`, so the animations are the same regardless of the speed
+ * of the machine and every frame is measured with the microsecond tick of the built-in profiler.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "src/lvgl_private.h"
+#include "demos/lv_demos.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DEF_HOR_RES     800
+#define DEF_VER_RES     480
+#define DEF_FRAME_CNT   300
+
+/*Frames rendered after loading a scene but not measured*/
+#define WARMUP_FRAME_CNT    5
+
+/*The draw buffer has this many lines*/
+#define DRAW_BUF_LINES  (DEF_VER_RES / 10)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_color_format_t cf;
+    const char * name;
+} color_format_dsc_t;
+
+typedef struct {
+    uint32_t frame_cnt;             /**< Number of frames the scene was running*/
+    uint32_t rendered_frame_cnt;    /**< Number of frames which redrew something*/
+    uint64_t render_us;             /**< Sum of the rendering times without flushing*/
+    uint64_t flush_us;              /**< Sum of the flushing and waiting for the flush*/
+    uint64_t busy_us;               /**< Sum of the time spent in `lv_timer_handler()`*/
+    size_t peak_mem_used;           /**< The maximal heap usage while the scene was running*/
+} scene_result_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t virtual_tick_cb(void);
+static uint32_t tick_us_cb(void);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static lv_display_t * display_create(lv_color_format_t cf, int32_t hor_res, int32_t ver_res);
+static void display_delete(lv_display_t * disp);
+static void run_scene(lv_display_t * disp, uint32_t idx, uint32_t frame_cnt, scene_result_t * res);
+static void write_scene(FILE * f, const char * name, const scene_result_t * res, bool last);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const color_format_dsc_t color_formats[] = {
+    {LV_COLOR_FORMAT_RGB565, "RGB565"},
+    {LV_COLOR_FORMAT_RGB888, "RGB888"},
+    {LV_COLOR_FORMAT_ARGB8888, "ARGB8888"},
+};
+
+static uint32_t virtual_tick;
+static uint8_t * frame_buf;
+static uint8_t * draw_buf_1;
+static uint8_t * draw_buf_2;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * out_path = "benchmark.json";
+    uint32_t frame_cnt = DEF_FRAME_CNT;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--output") == 0 && i + 1 < argc) out_path = argv[++i];
+        else if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frame_cnt = (uint32_t)atoi(argv[++i]);
+        else {
+            fprintf(stderr, "Usage: %s [--output <file.json>] [--frames <count per scene>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    lv_init();
+    lv_tick_set_cb(virtual_tick_cb);
+
+    /*Measure in microseconds but don't record any trace events*/
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = tick_us_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(false);
+
+    FILE * f = fopen(out_path, "w");
+    if(f == NULL) {
+        fprintf(stderr, "Couldn't open %s\n", out_path);
+        return 1;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"lvgl_version\": \"%d.%d.%d%s%s\",\n", LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH,
+            LVGL_VERSION_INFO[0] ? "-" : "", LVGL_VERSION_INFO);
+    fprintf(f, "  \"draw_unit_cnt\": %d,\n", LV_DRAW_SW_DRAW_UNIT_CNT);
+    fprintf(f, "  \"hor_res\": %d,\n", DEF_HOR_RES);
+    fprintf(f, "  \"ver_res\": %d,\n", DEF_VER_RES);
+    fprintf(f, "  \"frame_cnt\": %" LV_PRIu32 ",\n", frame_cnt);
+    fprintf(f, "  \"frame_period_ms\": %d,\n", LV_DEF_REFR_PERIOD);
+    fprintf(f, "  \"results\": [\n");
+
+    uint32_t scene_cnt = lv_demo_benchmark_get_scene_count();
+    uint32_t c;
+    for(c = 0; c < sizeof(color_formats) / sizeof(color_formats[0]); c++) {
+        lv_display_t * disp = display_create(color_formats[c].cf, DEF_HOR_RES, DEF_VER_RES);
+
+        fprintf(f, "    {\n");
+        fprintf(f, "      \"color_format\": \"%s\",\n", color_formats[c].name);
+        fprintf(f, "      \"scenes\": [\n");
+
+        uint32_t s;
+        for(s = 0; s < scene_cnt; s++) {
+            const char * name = lv_demo_benchmark_get_scene_name(s);
+            printf("%s, %d draw unit(s): %s\n", color_formats[c].name, LV_DRAW_SW_DRAW_UNIT_CNT, name);
+
+            scene_result_t res;
+            run_scene(disp, s, frame_cnt, &res);
+            write_scene(f, name, &res, s == scene_cnt - 1);
+        }
+
+        fprintf(f, "      ]\n");
+        fprintf(f, "    }%s\n", c == sizeof(color_formats) / sizeof(color_formats[0]) - 1 ? "" : ",");
+
+        display_delete(disp);
+    }
+
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+    fclose(f);
+
+    printf("Results saved to %s\n", out_path);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t virtual_tick_cb(void)
+{
+    return virtual_tick;
+}
+
+static uint32_t tick_us_cb(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    /*Copy the rendered area to a frame buffer to have a realistic flush*/
+    uint32_t px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    uint32_t fb_stride = lv_display_get_horizontal_resolution(disp) * px_size;
+    uint32_t buf_stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), lv_display_get_color_format(disp));
+    uint32_t line_size = lv_area_get_width(area) * px_size;
+
+    uint8_t * fb = frame_buf + area->y1 * fb_stride + area->x1 * px_size;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(fb, px_map, line_size);
+        fb += fb_stride;
+        px_map += buf_stride;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static lv_display_t * display_create(lv_color_format_t cf, int32_t hor_res, int32_t ver_res)
+{
+    lv_display_t * disp = lv_display_create(hor_res, ver_res);
+    lv_display_set_color_format(disp, cf);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    uint32_t buf_size = lv_draw_buf_width_to_stride(hor_res, cf) * DRAW_BUF_LINES;
+    draw_buf_1 = malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    draw_buf_2 = malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    frame_buf = malloc(hor_res * ver_res * lv_color_format_get_size(cf));
+    LV_ASSERT_MALLOC(draw_buf_1);
+    LV_ASSERT_MALLOC(draw_buf_2);
+    LV_ASSERT_MALLOC(frame_buf);
+
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf_1, cf), lv_draw_buf_align(draw_buf_2, cf), buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    return disp;
+}
+
+static void display_delete(lv_display_t * disp)
+{
+    lv_display_delete(disp);
+    free(draw_buf_1);
+    free(draw_buf_2);
+    free(frame_buf);
+}
+
+static void run_scene(lv_display_t * disp, uint32_t idx, uint32_t frame_cnt, scene_result_t * res)
+{
+    lv_memzero(res, sizeof(scene_result_t));
+
+    lv_demo_benchmark_load_scene(idx);
+
+    uint32_t i;
+    for(i = 0; i < WARMUP_FRAME_CNT; i++) {
+        virtual_tick += LV_DEF_REFR_PERIOD;
+        lv_timer_handler();
+    }
+
+    lv_sysmon_clear_frame_stats(disp);
+    LV_GLOBAL_DEFAULT()->tlsf_state.max_used = LV_GLOBAL_DEFAULT()->tlsf_state.cur_used;
+
+    for(i = 0; i < frame_cnt; i++) {
+        virtual_tick += LV_DEF_REFR_PERIOD;
+
+        uint32_t t = tick_us_cb();
+        lv_timer_handler();
+        res->busy_us += tick_us_cb() - t;
+        res->frame_cnt++;
+
+        lv_sysmon_frame_stats_t stats;
+        if(lv_sysmon_get_frame_stats(disp, &stats, 1) == 0) continue;
+        lv_sysmon_clear_frame_stats(disp);
+
+        uint32_t flush_us = stats.flush_cb_us + stats.flush_wait_us;
+        res->rendered_frame_cnt++;
+        res->render_us += stats.render_us - flush_us;
+        res->flush_us += flush_us;
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    res->peak_mem_used = mon.max_used;
+}
+
+static void write_scene(FILE * f, const char * name, const scene_result_t * res, bool last)
+{
+    uint32_t render_avg_us = 0;
+    uint32_t flush_avg_us = 0;
+    if(res->rendered_frame_cnt) {
+        render_avg_us = (uint32_t)(res->render_us / res->rendered_frame_cnt);
+        flush_avg_us = (uint32_t)(res->flush_us / res->rendered_frame_cnt);
+    }
+
+    /*The percentage of the frame periods spent in LVGL. Can be more than 100 if a frame
+     *takes longer than `LV_DEF_REFR_PERIOD`*/
+    uint32_t cpu_pct = 0;
+    if(res->frame_cnt) {
+        cpu_pct = (uint32_t)(res->busy_us * 100 / ((uint64_t)res->frame_cnt * LV_DEF_REFR_PERIOD * 1000));
+    }
+
+    fprintf(f, "        {\n");
+    fprintf(f, "          \"name\": \"%s\",\n", name);
+    fprintf(f, "          \"frame_cnt\": %" LV_PRIu32 ",\n", res->frame_cnt);
+    fprintf(f, "          \"rendered_frame_cnt\": %" LV_PRIu32 ",\n", res->rendered_frame_cnt);
+    fprintf(f, "          \"render_avg_us\": %" LV_PRIu32 ",\n", render_avg_us);
+    fprintf(f, "          \"flush_avg_us\": %" LV_PRIu32 ",\n", flush_avg_us);
+    fprintf(f, "          \"cpu_pct\": %" LV_PRIu32 ",\n", cpu_pct);
+    fprintf(f, "          \"peak_mem_used\": %zu\n", res->peak_mem_used);
+    fprintf(f, "        }%s\n", last ? "" : ",");
+}
@@ -22,7 +22,16 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_RESOLVED_CACHE 4   /* The DEF_HEAP build tests without the resolved style cache */
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
+#if defined(__x86_64__) || defined(__i386__)
+#define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_X86_SIMD   /* The DEF_HEAP build tests the C blending */
+#endif
+#endif
+
+#ifdef LVGL_CI_PARALLEL_RENDERING
+#define LV_DRAW_SW_DRAW_UNIT_CNT        4   /* Render in parallel to test the dependencies and the shared caches */
+#define LV_DRAW_SW_BAND_SPLIT_MIN_AREA  (100 * 100)
 #endif
 
 #ifdef LVGL_CI_USING_DEF_HEAP
@@ -31,6 +40,8 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_DRAW_TASK_ARENA_SIZE 2048    /* The SYS_HEAP build allocates the draw tasks one by one to catch overflows */
+#define LV_MEM_THREAD_CACHE     8       /* Cache the small blocks, the SYS_HEAP build doesn't use the builtin heap */
 #endif
 
 #ifdef MICROPYTHON
@@ -45,6 +45,8 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE 256
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (64 * 1024)
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
@@ -91,6 +93,7 @@
 #define LV_USE_SYSMON           1
 #define LV_USE_MEM_MONITOR      1
 #define LV_USE_PERF_MONITOR     1
+#define LV_SYSMON_FRAME_STATS_CNT   8
 #define LV_USE_SNAPSHOT         1
 #define LV_USE_THORVG_INTERNAL  1
 #define LV_USE_LZ4_INTERNAL     1
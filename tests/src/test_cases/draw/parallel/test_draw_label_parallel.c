@@ -0,0 +1,46 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_obj_set_flex_flow(lv_screen_active(), LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(lv_screen_active(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_label_parallel_cjk(void)
+{
+    /*With more draw units the labels are drawn in parallel and they look up the glyph indices
+     *in the same glyph index cache (`LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE`)*/
+    static const char * texts[] = {
+        "天地玄黄宇宙洪荒日月盈昃辰宿列张寒来暑往秋收冬藏",
+        "闰余成岁律吕调阳云腾致雨露结为霜金生丽水玉出昆冈",
+        "剑号巨阙珠称夜光果珍李柰菜重芥姜海咸河淡鳞潜羽翔",
+        "龙师火帝鸟官人皇始制文字乃服衣裳推位让国有虞陶唐",
+        "吊民伐罪周发殷汤坐朝问道垂拱平章爱育黎首臣伏戎羌",
+        "遐迩一体率宾归王鸣凤在竹白驹食场化被草木赖及万方",
+    };
+
+    uint32_t i;
+    for(i = 0; i < 2 * sizeof(texts) / sizeof(texts[0]); i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_width(label, 380);
+        lv_obj_set_style_text_font(label, i % 2 ? &lv_font_simsun_16_cjk : &lv_font_simsun_14_cjk, 0);
+        lv_label_set_text(label, texts[i / 2]);
+    }
+
+    uint32_t j;
+    for(j = 0; j < 4; j++) {
+        lv_obj_invalidate(lv_screen_active());
+        TEST_ASSERT_EQUAL_SCREENSHOT("draw/label_cjk_in_parallel.png");
+    }
+}
+
+#endif
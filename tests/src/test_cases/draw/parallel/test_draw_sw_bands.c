@@ -0,0 +1,65 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The reference images are rendered without splitting the draw tasks into bands,
+ *so the draw tasks split by multiple draw units need to give the same result*/
+
+void setUp(void)
+{
+    /*Only the bands split the draw tasks, the reference images were rendered without tiles*/
+    lv_display_set_tile_cnt(lv_display_get_default(), 1);
+}
+
+void tearDown(void)
+{
+    lv_display_set_tile_cnt(lv_display_get_default(), LV_DRAW_SW_DRAW_UNIT_CNT);
+    lv_obj_clean(lv_screen_active());
+    lv_obj_remove_style_all(lv_screen_active());
+}
+
+static lv_obj_t * masked_obj_create(lv_obj_t * parent, int32_t angle)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_set_size(obj, 300, 300);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0xf88), 0);
+    lv_obj_set_style_bitmap_mask_src(obj, &test_image_cogwheel_a8, 0);
+    lv_obj_set_style_transform_rotation(obj, angle, 0);
+    lv_obj_set_style_transform_pivot_x(obj, lv_pct(50), 0);
+    lv_obj_set_style_transform_pivot_y(obj, lv_pct(50), 0);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label, "Lorem ipsum dolor sit amet, consectetur adipiscing elit. "
+                      "Quisque suscipit risus nec pharetra pulvinar. In hac habitasse platea dictumst.");
+    lv_obj_center(label);
+
+    return obj;
+}
+
+void test_draw_sw_bands_masked_layer_and_large_fill(void)
+{
+    /*A full screen gradient which is split into bands*/
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x204080), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0xc0e0ff), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(scr, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    /*Large layers with a bitmap mask, the mask is applied on the whole layer only once*/
+    masked_obj_create(scr, 0);
+    masked_obj_create(scr, 300);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_sw_bands.png");
+
+    /*The same again to render into a layer which is not cleared*/
+    lv_obj_invalidate(scr);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/draw_sw_bands.png");
+}
+
+#endif
@@ -0,0 +1,205 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The layer is not added to the display, so its draw tasks stay queued and they are not drawn*/
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    lv_memzero(&layer, sizeof(layer));
+    lv_area_set(&layer.buf_area, 0, 0, 799, 479);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+}
+
+void tearDown(void)
+{
+    /*Remove the tasks as if they were drawn*/
+    lv_draw_task_t * t;
+    for(t = layer.draw_task_head; t; t = t->next) t->state = LV_DRAW_TASK_STATE_READY;
+    lv_draw_dispatch_layer(lv_display_get_default(), &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+}
+
+#if LV_DRAW_TASK_INDEX_TILE_SIZE && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+
+/*The draw units don't take the tasks with this ID even if the layer is dispatched*/
+#define TEST_UNIT_ID    100
+
+static lv_draw_task_t * fill_add(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0xff0000);
+
+    lv_area_t a;
+    lv_area_set(&a, x1, y1, x2, y2);
+    lv_draw_rect(&layer, &dsc, &a);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t->next) t = t->next;
+    t->preferred_draw_unit_id = TEST_UNIT_ID;
+    return t;
+}
+
+static lv_draw_task_t * get_next(lv_draw_task_t * t_prev)
+{
+    return lv_draw_get_next_available_task(&layer, t_prev, TEST_UNIT_ID);
+}
+
+/*The same as `lv_draw_get_next_available_task()` without the index*/
+static lv_draw_task_t * get_next_ref(lv_draw_task_t * t_prev)
+{
+    lv_draw_task_t * t_check = t_prev ? t_prev->next : layer.draw_task_head;
+    while(t_check) {
+        if(t_check->state == LV_DRAW_TASK_STATE_QUEUED) {
+            bool independent = true;
+            lv_draw_task_t * t;
+            for(t = layer.draw_task_head; t != t_check; t = t->next) {
+                if(t->state != LV_DRAW_TASK_STATE_READY && lv_area_is_on(&t->_real_area, &t_check->_real_area)) {
+                    independent = false;
+                    break;
+                }
+            }
+            if(independent) return t_check;
+        }
+        t_check = t_check->next;
+    }
+
+    return NULL;
+}
+
+static uint32_t get_dependent_count_ref(lv_draw_task_t * t_check)
+{
+    uint32_t cnt = 0;
+    lv_draw_task_t * t;
+    for(t = t_check->next; t; t = t->next) {
+        if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
+           lv_area_is_on(&t_check->area, &t->area)) {
+            cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+static void check_same_as_linear_search(void)
+{
+    lv_draw_task_t * t_ref = get_next_ref(NULL);
+    lv_draw_task_t * t = get_next(NULL);
+    while(t_ref) {
+        TEST_ASSERT_EQUAL_PTR(t_ref, t);
+        TEST_ASSERT_EQUAL_UINT32(get_dependent_count_ref(t), lv_draw_get_dependent_count(t));
+        t_ref = get_next_ref(t_ref);
+        t = get_next(t);
+    }
+    TEST_ASSERT_NULL(t);
+}
+
+#endif
+
+void test_draw_task_index_not_overlapping(void)
+{
+#if LV_DRAW_TASK_INDEX_TILE_SIZE && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    /*On both sides of a tile boundary*/
+    int32_t b = LV_DRAW_TASK_INDEX_TILE_SIZE;
+    lv_draw_task_t * t1 = fill_add(b - 10, 10, b - 1, 20);
+    lv_draw_task_t * t2 = fill_add(b, 10, b + 10, 20);
+    /*In the same tile*/
+    lv_draw_task_t * t3 = fill_add(b, 30, b + 10, 40);
+    /*Far away*/
+    lv_draw_task_t * t4 = fill_add(600, 400, 700, 450);
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+
+    /*All of them can be drawn in parallel, in the order of creation*/
+    TEST_ASSERT_EQUAL_PTR(t1, get_next(NULL));
+    TEST_ASSERT_EQUAL_PTR(t2, get_next(t1));
+    TEST_ASSERT_EQUAL_PTR(t3, get_next(t2));
+    TEST_ASSERT_EQUAL_PTR(t4, get_next(t3));
+    TEST_ASSERT_NULL(get_next(t4));
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_draw_get_dependent_count(t1));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_draw_get_dependent_count(t2));
+#endif
+}
+
+void test_draw_task_index_overlapping(void)
+{
+#if LV_DRAW_TASK_INDEX_TILE_SIZE && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    int32_t b = LV_DRAW_TASK_INDEX_TILE_SIZE;
+    /*A large task on many tiles*/
+    lv_draw_task_t * t1 = fill_add(b / 2, b / 2, 3 * b + b / 2, 2 * b + b / 2);
+    /*Overlaps t1 only in the tile where t1 ends*/
+    lv_draw_task_t * t2 = fill_add(3 * b + b / 2, 2 * b + b / 2, 4 * b + b / 2, 3 * b + b / 2);
+    /*Shares tiles with t1 and t2 but doesn't overlap them*/
+    lv_draw_task_t * t3 = fill_add(3 * b + b / 2 + 1, b / 2, 4 * b, 2 * b + b / 2 - 1);
+    /*Overlaps t2 only*/
+    lv_draw_task_t * t4 = fill_add(4 * b, 3 * b, 5 * b, 4 * b);
+
+    TEST_ASSERT_EQUAL_PTR(t1, get_next(NULL));
+    TEST_ASSERT_EQUAL_PTR(t3, get_next(t1));
+    TEST_ASSERT_NULL(get_next(t3));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_draw_get_dependent_count(t1));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_draw_get_dependent_count(t2));
+
+    /*Still blocks the newer tasks while it's being drawn*/
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_EQUAL_PTR(t3, get_next(NULL));
+
+    t1->state = LV_DRAW_TASK_STATE_READY;
+    TEST_ASSERT_EQUAL_PTR(t2, get_next(NULL));
+    TEST_ASSERT_EQUAL_PTR(t3, get_next(t2));
+    TEST_ASSERT_NULL(get_next(t3));
+
+    t2->state = LV_DRAW_TASK_STATE_READY;
+    TEST_ASSERT_EQUAL_PTR(t3, get_next(NULL));
+    TEST_ASSERT_EQUAL_PTR(t4, get_next(t3));
+#endif
+}
+
+void test_draw_task_index_same_as_linear_search(void)
+{
+#if LV_DRAW_TASK_INDEX_TILE_SIZE && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    /*Pseudo random tasks, many of them crossing tile boundaries*/
+    uint32_t seed = 12345;
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t x = (seed >> 8) % 760;
+        int32_t y = (seed >> 16) % 440;
+        int32_t w = 1 + (seed >> 4) % (i % 10 == 0 ? 300 : 40);
+        int32_t h = 1 + (seed >> 12) % (i % 10 == 0 ? 200 : 40);
+        fill_add(x, y, x + w - 1, y + h - 1);
+    }
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+
+    /*Take the tasks like the draw units, and finish them in a different order*/
+    uint32_t step;
+    for(step = 0; layer.draw_task_head; step++) {
+        check_same_as_linear_search();
+
+        lv_draw_task_t * t = get_next(NULL);
+        for(i = 0; t; i++) {
+            t->state = i % 2 == step % 2 ? LV_DRAW_TASK_STATE_READY : LV_DRAW_TASK_STATE_IN_PROGRESS;
+            t = get_next(t);
+        }
+
+        /*Remove the finished tasks from the index too*/
+        lv_draw_dispatch_layer(lv_display_get_default(), &layer);
+        check_same_as_linear_search();
+
+        for(t = layer.draw_task_head; t; t = t->next) {
+            if(t->state == LV_DRAW_TASK_STATE_IN_PROGRESS) t->state = LV_DRAW_TASK_STATE_READY;
+        }
+        lv_draw_dispatch_layer(lv_display_get_default(), &layer);
+    }
+
+    TEST_ASSERT_GREATER_THAN_UINT32(2, step);
+#endif
+}
+
+#endif
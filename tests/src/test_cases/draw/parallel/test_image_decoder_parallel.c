@@ -0,0 +1,161 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <unistd.h>
+
+/*The images are decoded slowly, so the draw units surely open them at the same time*/
+#define DECODE_TIME_MS  50
+#define IMAGE_CNT       4
+
+/*The files are opened before the decoders are asked, but the slow decoder doesn't read them*/
+static const char * srcs[IMAGE_CNT] = {
+    "A:src/test_files/binimages/cogwheel.I1.bin",
+    "A:src/test_files/binimages/cogwheel.I2.bin",
+    "A:src/test_files/binimages/cogwheel.I4.bin",
+    "A:src/test_files/binimages/cogwheel.I8.bin",
+};
+static const uint32_t colors[IMAGE_CNT] = {0xffff0000, 0xff00ff00, 0xff0000ff, 0xff808080};
+
+static lv_image_decoder_t * slow_decoder;
+static lv_obj_t * cont;
+static lv_mutex_t stat_mutex;
+static uint32_t decode_cnt[IMAGE_CNT];
+static uint32_t decoding_now;
+static uint32_t decoding_max;
+
+static int32_t src_to_idx(const lv_image_decoder_dsc_t * dsc)
+{
+    if(dsc->src_type != LV_IMAGE_SRC_FILE) return -1;
+
+    int32_t i;
+    for(i = 0; i < IMAGE_CNT; i++) {
+        if(lv_strcmp(dsc->src, srcs[i]) == 0) return i;
+    }
+
+    return -1;
+}
+
+static lv_result_t slow_decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                     lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(src_to_idx(dsc) < 0) return LV_RESULT_INVALID;
+
+    header->w = 64;
+    header->h = 64;
+    header->cf = LV_COLOR_FORMAT_ARGB8888;
+    header->stride = lv_draw_buf_width_to_stride(header->w, header->cf);
+    return LV_RESULT_OK;
+}
+
+static lv_result_t slow_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    int32_t idx = src_to_idx(dsc);
+
+    lv_mutex_lock(&stat_mutex);
+    decode_cnt[idx]++;
+    decoding_now++;
+    if(decoding_now > decoding_max) decoding_max = decoding_now;
+    lv_mutex_unlock(&stat_mutex);
+
+    usleep(DECODE_TIME_MS * 1000);
+
+    lv_draw_buf_t * decoded = lv_draw_buf_create(dsc->header.w, dsc->header.h, dsc->header.cf, 0);
+    uint32_t y;
+    for(y = 0; y < decoded->header.h; y++) {
+        uint32_t * row = lv_draw_buf_goto_xy(decoded, 0, y);
+        uint32_t x;
+        for(x = 0; x < decoded->header.w; x++) row[x] = colors[idx];
+    }
+
+    lv_mutex_lock(&stat_mutex);
+    decoding_now--;
+    lv_mutex_unlock(&stat_mutex);
+
+    dsc->decoded = decoded;
+
+    lv_image_cache_data_t search_key;
+    search_key.src_type = dsc->src_type;
+    search_key.src = dsc->src;
+    search_key.slot.size = decoded->data_size;
+    dsc->cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, decoded, NULL);
+
+    return LV_RESULT_OK;
+}
+
+static void slow_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    /*The image cache destroys the cached images*/
+    if(dsc->cache_entry == NULL) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
+}
+
+void setUp(void)
+{
+    lv_mutex_init(&stat_mutex);
+    lv_memzero(decode_cnt, sizeof(decode_cnt));
+    decoding_now = 0;
+    decoding_max = 0;
+
+    slow_decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(slow_decoder, slow_decoder_info);
+    lv_image_decoder_set_open_cb(slow_decoder, slow_decoder_open);
+    lv_image_decoder_set_close_cb(slow_decoder, slow_decoder_close);
+
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_image_decoder_delete(slow_decoder);
+    lv_mutex_delete(&stat_mutex);
+}
+
+static void images_create(bool same_src)
+{
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_obj_t * img = lv_image_create(cont);
+        lv_image_set_src(img, srcs[same_src ? 0 : i % IMAGE_CNT]);
+    }
+}
+
+void test_image_decoder_parallel_same_src_is_decoded_once(void)
+{
+    /*The draw units open the same, not cached image at the same time.
+     *Only one of them decodes it, the others wait for it and take it from the cache.*/
+    images_create(true);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(1, decode_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, decoding_max);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_parallel_same_src.png");
+
+    /*Already cached*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, decode_cnt[0]);
+}
+
+void test_image_decoder_parallel_different_srcs(void)
+{
+    /*The different images are decoded in parallel, but each only once*/
+    images_create(false);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < IMAGE_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1, decode_cnt[i]);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(1, decoding_max);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_parallel_different_srcs.png");
+}
+
+#endif
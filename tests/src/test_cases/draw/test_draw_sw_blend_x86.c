@@ -0,0 +1,217 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+#include "../../src/draw/sw/blend/x86/lv_blend_x86.h"
+#endif
+
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+
+/*Not a multiple of any SIMD width to test the tails too*/
+#define TEST_W          45
+#define TEST_H          7
+#define TEST_STRIDE     (TEST_W * 4 + 12)
+#define TEST_MASK_STRIDE (TEST_W + 3)
+
+typedef enum {
+    TEST_DEST_RGB565,
+    TEST_DEST_XRGB8888,
+    TEST_DEST_ARGB8888,
+} test_dest_t;
+
+static uint8_t dest_init[TEST_STRIDE * TEST_H];
+static uint8_t dest_ref[TEST_STRIDE * TEST_H];
+static uint8_t dest_simd[TEST_STRIDE * TEST_H];
+static uint8_t src_buf[TEST_STRIDE * TEST_H];
+static lv_opa_t mask_buf[TEST_MASK_STRIDE * TEST_H];
+static uint32_t rnd_state;
+
+static const lv_opa_t opa_list[] = {LV_OPA_COVER, LV_OPA_MAX, LV_OPA_MAX - 1, 128, 7, LV_OPA_MIN + 1};
+
+static uint8_t rnd_u8(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (uint8_t)(rnd_state >> 16);
+}
+
+/*Random values, but the edge cases of the mixing functions are more likely*/
+static uint8_t rnd_opa(void)
+{
+    static const lv_opa_t edges[] = {0, 1, 2, 3, 4, 252, 253, 254, 255};
+    uint8_t r = rnd_u8();
+    if(r & 0x1) return edges[rnd_u8() % sizeof(edges)];
+    return rnd_u8();
+}
+
+static void fill_random(bool opaque_dest)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(dest_init); i++) {
+        /*Each 4th byte is the alpha channel of the 32 bit formats*/
+        if((i & 0x3) == 3) dest_init[i] = opaque_dest ? 0xFF : rnd_opa();
+        else dest_init[i] = rnd_u8();
+        src_buf[i] = (i & 0x3) == 3 ? rnd_opa() : rnd_u8();
+    }
+
+    for(i = 0; i < sizeof(mask_buf); i++) {
+        mask_buf[i] = rnd_opa();
+    }
+}
+
+static uint32_t dest_px_size(test_dest_t dest)
+{
+    return dest == TEST_DEST_RGB565 ? 2 : 4;
+}
+
+static void blend_color(test_dest_t dest, uint8_t * buf, lv_color_t color, lv_opa_t opa, bool masked)
+{
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = buf;
+    dsc.dest_w = TEST_W;
+    dsc.dest_h = TEST_H;
+    dsc.dest_stride = TEST_STRIDE;
+    dsc.color = color;
+    dsc.opa = opa;
+    dsc.mask_buf = masked ? mask_buf : NULL;
+    dsc.mask_stride = TEST_MASK_STRIDE;
+
+    if(dest == TEST_DEST_RGB565) lv_draw_sw_blend_color_to_rgb565(&dsc);
+    else if(dest == TEST_DEST_XRGB8888) lv_draw_sw_blend_color_to_rgb888(&dsc, 4);
+    else lv_draw_sw_blend_color_to_argb8888(&dsc);
+}
+
+static void blend_image(test_dest_t dest, uint8_t * buf, lv_color_format_t src_cf, lv_opa_t opa, bool masked)
+{
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = buf;
+    dsc.dest_w = TEST_W;
+    dsc.dest_h = TEST_H;
+    dsc.dest_stride = TEST_STRIDE;
+    dsc.src_buf = src_buf;
+    dsc.src_stride = TEST_STRIDE;
+    dsc.src_color_format = src_cf;
+    dsc.opa = opa;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    dsc.mask_buf = masked ? mask_buf : NULL;
+    dsc.mask_stride = TEST_MASK_STRIDE;
+
+    if(dest == TEST_DEST_RGB565) lv_draw_sw_blend_image_to_rgb565(&dsc);
+    else if(dest == TEST_DEST_XRGB8888) lv_draw_sw_blend_image_to_rgb888(&dsc, 4);
+    else lv_draw_sw_blend_image_to_argb8888(&dsc);
+}
+
+/*Blend with the C implementation and with the given SIMD level and compare the results*/
+static void test_blend(test_dest_t dest, bool image, lv_color_format_t src_cf, lv_opa_t opa, bool masked,
+                       lv_draw_sw_x86_simd_t level)
+{
+    lv_color_t color = lv_color_make(rnd_u8(), rnd_u8(), rnd_u8());
+
+    lv_memcpy(dest_ref, dest_init, sizeof(dest_init));
+    lv_memcpy(dest_simd, dest_init, sizeof(dest_init));
+
+    lv_draw_sw_x86_simd_set_level(LV_DRAW_SW_X86_SIMD_NONE);
+    if(image) blend_image(dest, dest_ref, src_cf, opa, masked);
+    else blend_color(dest, dest_ref, color, opa, masked);
+
+    lv_draw_sw_x86_simd_set_level(level);
+    if(image) blend_image(dest, dest_simd, src_cf, opa, masked);
+    else blend_color(dest, dest_simd, color, opa, masked);
+
+    int32_t y;
+    for(y = 0; y < TEST_H; y++) {
+        uint32_t row_size = TEST_W * dest_px_size(dest);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&dest_ref[y * TEST_STRIDE], &dest_simd[y * TEST_STRIDE], row_size);
+    }
+}
+
+static void test_all(test_dest_t dest, lv_draw_sw_x86_simd_t level)
+{
+    static const lv_color_format_t src_cfs[] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888};
+
+    if(lv_draw_sw_x86_simd_get_level() < level) {
+        TEST_IGNORE_MESSAGE("The CPU doesn't support this instruction set");
+    }
+
+    uint32_t round;
+    for(round = 0; round < 4; round++) {
+        /*Opaque destinations are the most common and they are handled differently*/
+        fill_random(round & 0x1);
+
+        uint32_t o;
+        for(o = 0; o < sizeof(opa_list); o++) {
+            test_blend(dest, false, LV_COLOR_FORMAT_UNKNOWN, opa_list[o], false, level);
+            test_blend(dest, false, LV_COLOR_FORMAT_UNKNOWN, opa_list[o], true, level);
+
+            uint32_t s;
+            for(s = 0; s < sizeof(src_cfs) / sizeof(src_cfs[0]); s++) {
+                /*The same format to the 16 bit destination only*/
+                if(dest == TEST_DEST_RGB565 && src_cfs[s] == LV_COLOR_FORMAT_XRGB8888) continue;
+                if(dest != TEST_DEST_RGB565 && src_cfs[s] == LV_COLOR_FORMAT_RGB565) continue;
+
+                test_blend(dest, true, src_cfs[s], opa_list[o], false, level);
+                test_blend(dest, true, src_cfs[s], opa_list[o], true, level);
+            }
+        }
+    }
+}
+
+#else
+
+/*Ignore the tests if the x86 blending is not used*/
+#define test_all(dest, level) TEST_IGNORE_MESSAGE("LV_DRAW_SW_ASM_X86_SIMD is not enabled")
+
+#endif /*LV_DRAW_SW_X86_SIMD_AVAILABLE*/
+
+void setUp(void)
+{
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+    rnd_state = 0x12345678;
+#endif
+}
+
+void tearDown(void)
+{
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+    lv_draw_sw_x86_simd_set_level(LV_DRAW_SW_X86_SIMD_AVX2);
+#endif
+}
+
+void test_draw_sw_blend_x86_sse2_rgb565(void)
+{
+    test_all(TEST_DEST_RGB565, LV_DRAW_SW_X86_SIMD_SSE2);
+}
+
+void test_draw_sw_blend_x86_sse2_xrgb8888(void)
+{
+    test_all(TEST_DEST_XRGB8888, LV_DRAW_SW_X86_SIMD_SSE2);
+}
+
+void test_draw_sw_blend_x86_sse2_argb8888(void)
+{
+    test_all(TEST_DEST_ARGB8888, LV_DRAW_SW_X86_SIMD_SSE2);
+}
+
+void test_draw_sw_blend_x86_avx2_rgb565(void)
+{
+    test_all(TEST_DEST_RGB565, LV_DRAW_SW_X86_SIMD_AVX2);
+}
+
+void test_draw_sw_blend_x86_avx2_xrgb8888(void)
+{
+    test_all(TEST_DEST_XRGB8888, LV_DRAW_SW_X86_SIMD_AVX2);
+}
+
+void test_draw_sw_blend_x86_avx2_argb8888(void)
+{
+    test_all(TEST_DEST_ARGB8888, LV_DRAW_SW_X86_SIMD_AVX2);
+}
+
+#endif
@@ -0,0 +1,337 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+#include "../../src/draw/sw/blend/x86/lv_blend_x86.h"
+#endif
+
+/*The test images are 4x2 pixels: the left 2x2 block is red, the right 2x2 block is white.
+ *Y = 81, U = 90, V = 240 is (255, 0, 0) and Y = 235, U = V = 128 is (255, 255, 255) in BT.601*/
+#define IMG_W   4
+#define IMG_H   2
+
+static uint8_t y_plane[IMG_W * IMG_H] = {
+    81, 81, 235, 235,
+    81, 81, 235, 235,
+};
+
+/*A larger I420 image to test the conversion in blocks of pixels and in chunks too.
+ *The width is not a multiple of the block or chunk width to test the tails.*/
+#define BIG_W   150
+#define BIG_H   6
+
+static uint8_t big_y[BIG_W * BIG_H];
+static uint8_t big_u[(BIG_W / 2) * (BIG_H / 2)];
+static uint8_t big_v[(BIG_W / 2) * (BIG_H / 2)];
+static uint8_t big_argb8888[BIG_W * BIG_H * 4];
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(IMG_W * 4, IMG_H * 4, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(canvas_buf);
+
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+    lv_draw_sw_x86_simd_set_level(LV_DRAW_SW_X86_SIMD_AVX2);
+#endif
+}
+
+static void canvas_set_format(lv_color_format_t cf, int32_t w, int32_t h)
+{
+    lv_draw_buf_t * old_buf = canvas_buf;
+    canvas_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_draw_buf_destroy(old_buf);
+}
+
+static void draw_image(const lv_image_dsc_t * img, lv_opa_t opa, int32_t scale)
+{
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = img;
+    dsc.opa = opa;
+    dsc.scale_x = scale;
+    dsc.scale_y = scale;
+    dsc.antialias = 0;
+    lv_area_t coords = {0, 0, img->header.w - 1, img->header.h - 1};
+    lv_draw_image(&layer, &dsc, &coords);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_image_cache_drop(img);
+}
+
+static void image_dsc_init(lv_image_dsc_t * img, lv_color_format_t cf, int32_t w, int32_t h, const void * data,
+                           uint32_t data_size, uint32_t stride)
+{
+    lv_memzero(img, sizeof(lv_image_dsc_t));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = cf;
+    img->header.w = w;
+    img->header.h = h;
+    img->header.stride = stride;
+    img->data = data;
+    img->data_size = data_size;
+}
+
+static void draw_yuv(lv_color_format_t cf, const void * data, uint32_t data_size, uint32_t stride, int32_t scale)
+{
+    lv_image_dsc_t img;
+    image_dsc_init(&img, cf, IMG_W, IMG_H, data, data_size, stride);
+    draw_image(&img, LV_OPA_COVER, scale);
+}
+
+/*Random planes, and the same image converted to ARGB8888 pixel by pixel*/
+static void big_i420_init(lv_yuv_buf_t * yuv)
+{
+    uint32_t rnd = 12345;
+    uint32_t i;
+    for(i = 0; i < sizeof(big_y); i++) {
+        rnd = rnd * 1103515245 + 12345;
+        big_y[i] = (uint8_t)(rnd >> 16);
+    }
+    for(i = 0; i < sizeof(big_u); i++) {
+        rnd = rnd * 1103515245 + 12345;
+        big_u[i] = (uint8_t)(rnd >> 16);
+        big_v[i] = (uint8_t)(rnd >> 8);
+    }
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < BIG_H; y++) {
+        for(x = 0; x < BIG_W; x++) {
+            int32_t c = (y / 2) * (BIG_W / 2) + x / 2;
+            lv_color32_t px = lv_draw_sw_yuv_to_color32(big_y[y * BIG_W + x], big_u[c], big_v[c]);
+            lv_memcpy(&big_argb8888[(y * BIG_W + x) * 4], &px, 4);
+        }
+    }
+
+    yuv->planar.y.buf = big_y;
+    yuv->planar.y.stride = BIG_W;
+    yuv->planar.u.buf = big_u;
+    yuv->planar.u.stride = BIG_W / 2;
+    yuv->planar.v.buf = big_v;
+    yuv->planar.v.stride = BIG_W / 2;
+}
+
+/*Draw the I420 image and the same image in ARGB8888 and compare the results*/
+static void check_big_i420(lv_color_format_t dest_cf, lv_opa_t opa)
+{
+    lv_yuv_buf_t yuv;
+    big_i420_init(&yuv);
+
+    lv_image_dsc_t img_yuv;
+    image_dsc_init(&img_yuv, LV_COLOR_FORMAT_I420, BIG_W, BIG_H, &yuv, sizeof(yuv), 0);
+    lv_image_dsc_t img_argb;
+    image_dsc_init(&img_argb, LV_COLOR_FORMAT_ARGB8888, BIG_W, BIG_H, big_argb8888, sizeof(big_argb8888), BIG_W * 4);
+
+    canvas_set_format(dest_cf, BIG_W, BIG_H);
+    lv_draw_buf_t * ref_buf = lv_draw_buf_create(BIG_W, BIG_H, dest_cf, LV_STRIDE_AUTO);
+
+    draw_image(&img_argb, opa, LV_SCALE_NONE);
+    lv_draw_buf_copy(ref_buf, NULL, canvas_buf, NULL);
+    draw_image(&img_yuv, opa, LV_SCALE_NONE);
+
+    uint32_t row_size = BIG_W * lv_color_format_get_size(dest_cf);
+    int32_t y;
+    for(y = 0; y < BIG_H; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(ref_buf, 0, y), lv_draw_buf_goto_xy(canvas_buf, 0, y), row_size);
+    }
+
+    lv_draw_buf_destroy(ref_buf);
+}
+
+static void assert_px(int32_t x, int32_t y, uint8_t r, uint8_t g, uint8_t b)
+{
+    lv_color32_t px = lv_canvas_get_px(canvas, x, y);
+    TEST_ASSERT_EQUAL_UINT8(r, px.red);
+    TEST_ASSERT_EQUAL_UINT8(g, px.green);
+    TEST_ASSERT_EQUAL_UINT8(b, px.blue);
+    TEST_ASSERT_EQUAL_UINT8(0xff, px.alpha);
+}
+
+static void assert_red_white(void)
+{
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        assert_px(0, y, 0xff, 0x00, 0x00);
+        assert_px(1, y, 0xff, 0x00, 0x00);
+        assert_px(2, y, 0xff, 0xff, 0xff);
+        assert_px(3, y, 0xff, 0xff, 0xff);
+    }
+}
+
+static void assert_red_white_scaled(void)
+{
+    /*Scaled up 2x from the top left corner*/
+    int32_t y;
+    for(y = 0; y < IMG_H * 2; y++) {
+        assert_px(1, y, 0xff, 0x00, 0x00);
+        assert_px(2, y, 0xff, 0x00, 0x00);
+        assert_px(5, y, 0xff, 0xff, 0xff);
+        assert_px(6, y, 0xff, 0xff, 0xff);
+    }
+}
+
+static void test_planar(lv_color_format_t cf, uint8_t * u, uint8_t * v, uint32_t c_stride)
+{
+    lv_yuv_buf_t yuv;
+    yuv.planar.y.buf = y_plane;
+    yuv.planar.y.stride = IMG_W;
+    yuv.planar.u.buf = u;
+    yuv.planar.u.stride = c_stride;
+    yuv.planar.v.buf = v;
+    yuv.planar.v.stride = c_stride;
+
+    draw_yuv(cf, &yuv, sizeof(yuv), 0, LV_SCALE_NONE);
+    assert_red_white();
+
+    draw_yuv(cf, &yuv, sizeof(yuv), 0, LV_SCALE_NONE * 2);
+    assert_red_white_scaled();
+}
+
+void test_draw_sw_yuv_i420(void)
+{
+    uint8_t u[2] = {90, 128};
+    uint8_t v[2] = {240, 128};
+    test_planar(LV_COLOR_FORMAT_I420, u, v, 2);
+}
+
+void test_draw_sw_yuv_i422(void)
+{
+    uint8_t u[2 * IMG_H] = {90, 128, 90, 128};
+    uint8_t v[2 * IMG_H] = {240, 128, 240, 128};
+    test_planar(LV_COLOR_FORMAT_I422, u, v, 2);
+}
+
+void test_draw_sw_yuv_i444(void)
+{
+    uint8_t u[IMG_W * IMG_H] = {90, 90, 128, 128, 90, 90, 128, 128};
+    uint8_t v[IMG_W * IMG_H] = {240, 240, 128, 128, 240, 240, 128, 128};
+    test_planar(LV_COLOR_FORMAT_I444, u, v, IMG_W);
+}
+
+void test_draw_sw_yuv_i400(void)
+{
+    lv_yuv_buf_t yuv;
+    lv_memzero(&yuv, sizeof(yuv));
+    yuv.planar.y.buf = y_plane;
+    yuv.planar.y.stride = IMG_W;
+
+    draw_yuv(LV_COLOR_FORMAT_I400, &yuv, sizeof(yuv), 0, LV_SCALE_NONE);
+
+    /*(81 - 16) * 298 / 256 = 76*/
+    assert_px(0, 0, 76, 76, 76);
+    assert_px(1, 1, 76, 76, 76);
+    assert_px(3, 0, 0xff, 0xff, 0xff);
+}
+
+void test_draw_sw_yuv_nv12_nv21(void)
+{
+    uint8_t uv[4] = {90, 240, 128, 128};
+    lv_yuv_buf_t yuv;
+    yuv.semi_planar.y.buf = y_plane;
+    yuv.semi_planar.y.stride = IMG_W;
+    yuv.semi_planar.uv.buf = uv;
+    yuv.semi_planar.uv.stride = 4;
+
+    draw_yuv(LV_COLOR_FORMAT_NV12, &yuv, sizeof(yuv), 0, LV_SCALE_NONE);
+    assert_red_white();
+
+    draw_yuv(LV_COLOR_FORMAT_NV12, &yuv, sizeof(yuv), 0, LV_SCALE_NONE * 2);
+    assert_red_white_scaled();
+
+    uv[0] = 240;
+    uv[1] = 90;
+    draw_yuv(LV_COLOR_FORMAT_NV21, &yuv, sizeof(yuv), 0, LV_SCALE_NONE);
+    assert_red_white();
+}
+
+void test_draw_sw_yuv_yuy2_uyvy(void)
+{
+    uint8_t yuy2[IMG_W * 2 * IMG_H] = {
+        81, 90, 81, 240, 235, 128, 235, 128,
+        81, 90, 81, 240, 235, 128, 235, 128,
+    };
+
+    draw_yuv(LV_COLOR_FORMAT_YUY2, yuy2, sizeof(yuy2), IMG_W * 2, LV_SCALE_NONE);
+    assert_red_white();
+
+    draw_yuv(LV_COLOR_FORMAT_YUY2, yuy2, sizeof(yuy2), IMG_W * 2, LV_SCALE_NONE * 2);
+    assert_red_white_scaled();
+
+    uint8_t uyvy[IMG_W * 2 * IMG_H] = {
+        90, 81, 240, 81, 128, 235, 128, 235,
+        90, 81, 240, 81, 128, 235, 128, 235,
+    };
+
+    draw_yuv(LV_COLOR_FORMAT_UYVY, uyvy, sizeof(uyvy), IMG_W * 2, LV_SCALE_NONE);
+    assert_red_white();
+}
+
+void test_draw_sw_yuv_rgb565_rgb888_xrgb8888(void)
+{
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_XRGB8888};
+    uint8_t u[2] = {90, 128};
+    uint8_t v[2] = {240, 128};
+    lv_yuv_buf_t yuv;
+    yuv.planar.y.buf = y_plane;
+    yuv.planar.y.stride = IMG_W;
+    yuv.planar.u.buf = u;
+    yuv.planar.u.stride = 2;
+    yuv.planar.v.buf = v;
+    yuv.planar.v.stride = 2;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        canvas_set_format(cfs[i], IMG_W * 4, IMG_H * 4);
+        draw_yuv(LV_COLOR_FORMAT_I420, &yuv, sizeof(yuv), 0, LV_SCALE_NONE);
+        assert_red_white();
+    }
+}
+
+void test_draw_sw_yuv_direct_blend(void)
+{
+    /*The C implementation, and the SIMD one if available*/
+    uint32_t level_cnt = 1;
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+    level_cnt = 2;
+#endif
+
+    uint32_t level;
+    for(level = 0; level < level_cnt; level++) {
+#if defined(LV_DRAW_SW_X86_SIMD_AVAILABLE)
+        lv_draw_sw_x86_simd_set_level(level == 0 ? LV_DRAW_SW_X86_SIMD_NONE : LV_DRAW_SW_X86_SIMD_SSE2);
+#endif
+        check_big_i420(LV_COLOR_FORMAT_ARGB8888, LV_OPA_COVER);
+        check_big_i420(LV_COLOR_FORMAT_XRGB8888, LV_OPA_COVER);
+        check_big_i420(LV_COLOR_FORMAT_RGB888, LV_OPA_COVER);
+        check_big_i420(LV_COLOR_FORMAT_RGB565, LV_OPA_COVER);
+    }
+}
+
+void test_draw_sw_yuv_blend_with_opa(void)
+{
+    /*Blended from ARGB8888 chunks*/
+    check_big_i420(LV_COLOR_FORMAT_ARGB8888, LV_OPA_50);
+    check_big_i420(LV_COLOR_FORMAT_RGB888, LV_OPA_50);
+    check_big_i420(LV_COLOR_FORMAT_RGB565, LV_OPA_70);
+}
+
+#endif
@@ -0,0 +1,96 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+
+void setUp(void)
+{
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_TASK_ARENA_SIZE
+
+static uint32_t get_chunk_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_draw_arena_chunk_t * chunk = _draw_info.arena_head;
+    while(chunk) {
+        cnt++;
+        chunk = chunk->next;
+    }
+    return cnt;
+}
+
+#endif
+
+void test_draw_task_arena_reset_after_refresh(void)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_pos(obj, i * 20, i * 20);
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text(label, "Arena");
+    }
+
+    lv_refr_now(NULL);
+
+    /*All the draw tasks are finished so only an empty chunk remains*/
+    TEST_ASSERT_NOT_NULL(_draw_info.arena_head);
+    TEST_ASSERT_EQUAL_UINT32(1, get_chunk_cnt());
+    TEST_ASSERT_EQUAL_UINT32(0, _draw_info.arena_head->used);
+    TEST_ASSERT_EQUAL_UINT32(0, _draw_info.arena_head->live_cnt);
+
+    /*The same chunks are reused in the next frames*/
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+#endif
+}
+
+void test_draw_task_arena_chunks(void)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    void * p1 = lv_draw_arena_alloc(LV_DRAW_TASK_ARENA_SIZE / 2);
+    void * p2 = lv_draw_arena_alloc(3);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)p1 + LV_DRAW_TASK_ARENA_SIZE / 2, p2);
+
+    /*Doesn't fit into the current chunk*/
+    void * p3 = lv_draw_arena_alloc(LV_DRAW_TASK_ARENA_SIZE / 2);
+    TEST_ASSERT_EQUAL_UINT32(2, get_chunk_cnt());
+
+    /*Too large for any chunk*/
+    void * p4 = lv_draw_arena_alloc(LV_DRAW_TASK_ARENA_SIZE + 1);
+    TEST_ASSERT_NOT_NULL(p4);
+    TEST_ASSERT_EQUAL_UINT32(2, get_chunk_cnt());
+    lv_draw_arena_free(p4);
+
+    /*The old chunk is removed when it becomes empty*/
+    lv_draw_arena_free(p1);
+    lv_draw_arena_free(p2);
+    TEST_ASSERT_EQUAL_UINT32(1, get_chunk_cnt());
+    TEST_ASSERT_NOT_NULL(_draw_info.arena_spare);
+
+    /*The current chunk is reset*/
+    lv_draw_arena_free(p3);
+    TEST_ASSERT_EQUAL_UINT32(1, get_chunk_cnt());
+    TEST_ASSERT_EQUAL_UINT32(0, _draw_info.arena_head->used);
+    TEST_ASSERT_EQUAL_PTR(p3, lv_draw_arena_alloc(8));
+    lv_draw_arena_free(p3);
+#endif
+}
+
+#endif
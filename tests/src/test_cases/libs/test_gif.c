@@ -0,0 +1,129 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_GIF
+
+#define GIF_SRC "A:../examples/libs/gif/bulb.gif"
+
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+
+static void display_invalidate_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_cnt == 0) inv_area = *area;
+    else lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), display_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), display_invalidate_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void next_frame(lv_obj_t * gif)
+{
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    uint32_t delay = gifobj->frames_complete ? gifobj->frames[gifobj->frame_act].delay : gifobj->gif->gce.delay;
+    inv_cnt = 0;
+    lv_test_wait(delay * 10);
+}
+
+void test_gif_invalidate_frame_area(void)
+{
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, GIF_SRC);
+    lv_obj_set_pos(gif, 20, 30);
+    lv_refr_now(NULL);
+
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        uint8_t prev_disposal = gifobj->gif->gce.disposal;
+        next_frame(gif);
+        TEST_ASSERT_GREATER_THAN(0, inv_cnt);
+        TEST_ASSERT_TRUE(lv_area_is_in(&inv_area, &gif->coords, 0));
+
+        /*Only the area of the frame, or the restored area of the previous frame changed*/
+        gd_GIF * gd = gifobj->gif;
+        lv_area_t frame_area;
+        lv_area_set(&frame_area, gd->fx, gd->fy, gd->fx + gd->fw - 1, gd->fy + gd->fh - 1);
+        lv_area_move(&frame_area, gif->coords.x1, gif->coords.y1);
+        TEST_ASSERT_TRUE(lv_area_is_in(&frame_area, &inv_area, 0));
+        if(prev_disposal != 2) {
+            TEST_ASSERT_EQUAL_INT32(lv_area_get_size(&frame_area), lv_area_get_size(&inv_area));
+        }
+    }
+
+    /*The whole object is invalidated if the image is transformed*/
+    lv_image_set_rotation(gif, 450);
+    lv_refr_now(NULL);
+    next_frame(gif);
+    TEST_ASSERT_TRUE(lv_area_get_size(&inv_area) >= lv_area_get_size(&gif->coords));
+}
+
+void test_gif_frame_cache(void)
+{
+    /*Play the same GIF with and without caching, they should show the same frames*/
+    lv_obj_t * gif_ref = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif_ref, GIF_SRC);
+
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_frame_cache_size(gif, 4 * 1024 * 1024);
+    lv_gif_set_src(gif, GIF_SRC);
+
+    lv_gif_t * gifobj_ref = (lv_gif_t *)gif_ref;
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    uint32_t data_size = gifobj->imgdsc.data_size;
+
+    /*The loop has 113 frames*/
+    uint32_t i;
+    for(i = 0; i < 250; i++) {
+        next_frame(gif_ref);
+        TEST_ASSERT_EQUAL_MEMORY(gifobj_ref->imgdsc.data, gifobj->imgdsc.data, data_size);
+    }
+
+    TEST_ASSERT_TRUE(gifobj->frames_complete);
+    TEST_ASSERT_GREATER_THAN(1, gifobj->frame_cnt);
+    TEST_ASSERT_EQUAL_PTR(gifobj->frames[gifobj->frame_act].data, gifobj->imgdsc.data);
+
+    /*Continue decoding after disabling the cache*/
+    lv_gif_set_frame_cache_size(gif, 0);
+    TEST_ASSERT_NULL(gifobj->frames);
+    TEST_ASSERT_FALSE(gifobj->frames_complete);
+    TEST_ASSERT_EQUAL_PTR(gifobj->gif->canvas, gifobj->imgdsc.data);
+
+    int32_t frame_index = gifobj->gif->frame_index;
+    next_frame(gif);
+    TEST_ASSERT_EQUAL_INT32(frame_index + 1, gifobj->gif->frame_index);
+}
+
+void test_gif_frame_cache_too_small(void)
+{
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_t * gifobj = (lv_gif_t *)gif;
+    lv_gif_set_src(gif, GIF_SRC);
+    lv_gif_set_frame_cache_size(gif, 3 * gifobj->imgdsc.data_size);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        next_frame(gif);
+    }
+
+    TEST_ASSERT_FALSE(gifobj->frames_complete);
+    TEST_ASSERT_NULL(gifobj->frames);
+    TEST_ASSERT_EQUAL_PTR(gifobj->gif->canvas, gifobj->imgdsc.data);
+}
+
+#endif
+
+#endif
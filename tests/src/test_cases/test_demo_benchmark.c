@@ -0,0 +1,39 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_demo_benchmark_scenes(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    uint32_t cnt = lv_demo_benchmark_get_scene_count();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, cnt);
+    TEST_ASSERT_NULL(lv_demo_benchmark_get_scene_name(cnt));
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        TEST_ASSERT_NOT_NULL(lv_demo_benchmark_get_scene_name(i));
+
+        lv_demo_benchmark_load_scene(i);
+
+        /*Run the animations of the scene for some frames*/
+        uint32_t f;
+        for(f = 0; f < 10; f++) {
+            lv_tick_inc(LV_DEF_REFR_PERIOD);
+            lv_timer_handler();
+        }
+    }
+
+    /*Loading an invalid scene is ignored*/
+    lv_demo_benchmark_load_scene(cnt);
+#endif
+}
+
+#endif
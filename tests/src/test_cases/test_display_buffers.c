@@ -0,0 +1,83 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define BUF_CNT 3
+
+static lv_draw_buf_t * bufs[BUF_CNT];
+static lv_draw_buf_t * front_buf;
+static uint32_t flush_cnt[BUF_CNT];
+
+static lv_draw_buf_t * get_buf(uint8_t * px_map)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        if(bufs[i]->data == px_map) return bufs[i];
+    }
+
+    return NULL;
+}
+
+/*Rotate 3 buffers like a triple buffered driver*/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+
+    if(lv_display_flush_is_last(disp)) {
+        lv_draw_buf_t * flushed_buf = get_buf(px_map);
+        TEST_ASSERT_NOT_NULL(flushed_buf);
+        TEST_ASSERT_NOT_EQUAL(front_buf, flushed_buf);
+
+        uint32_t i;
+        for(i = 0; i < BUF_CNT; i++) {
+            if(bufs[i] == flushed_buf) flush_cnt[i]++;
+            else if(bufs[i] != front_buf) lv_display_set_next_draw_buffer(disp, bufs[i]);
+        }
+        front_buf = flushed_buf;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_display_set_next_draw_buffer(void)
+{
+    lv_display_t * disp = lv_display_create(40, 30);
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        bufs[i] = lv_draw_buf_create(40, 30, lv_display_get_color_format(disp), LV_STRIDE_AUTO);
+        flush_cnt[i] = 0;
+    }
+    front_buf = NULL;
+
+    lv_display_set_draw_buffers(disp, bufs[0], bufs[1]);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    for(i = 0; i < 3 * BUF_CNT; i++) {
+        lv_obj_invalidate(scr);
+        lv_refr_now(disp);
+    }
+
+    /*All the buffers are used in turns*/
+    for(i = 0; i < BUF_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(3, flush_cnt[i]);
+    }
+
+    lv_display_delete(disp);
+    for(i = 0; i < BUF_CNT; i++) {
+        lv_draw_buf_destroy(bufs[i]);
+    }
+}
+
+#endif
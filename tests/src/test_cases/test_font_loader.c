@@ -9,6 +9,7 @@
 
 #if LV_BUILD_TEST
 #include "../../lvgl.h"
+#include "../../lvgl_private.h"
 
 #include "unity/unity.h"
 
@@ -178,6 +179,107 @@ void test_font_loader_reload(void)
     lv_binfont_destroy(font);
 }
 
+static void check_glyph_ids(const lv_font_t * f_ref, const lv_font_t * f)
+{
+    /*ASCII, a symbol only in `test_font_1` and a missing character*/
+    static const uint32_t letters[] = {'A', 'z', ' ', 0xB0, 0x2022, 0xF001, 0x4E2D};
+
+    uint32_t i;
+    for(i = 0; i < sizeof(letters) / sizeof(letters[0]); i++) {
+        lv_font_glyph_dsc_t dsc_ref;
+        lv_font_glyph_dsc_t dsc;
+        bool found_ref = lv_font_get_glyph_dsc(f_ref, &dsc_ref, letters[i], 0);
+
+        /*The second lookup is from the cache*/
+        uint32_t j;
+        for(j = 0; j < 2; j++) {
+            TEST_ASSERT_EQUAL(found_ref, lv_font_get_glyph_dsc(f, &dsc, letters[i], 0));
+            if(found_ref) TEST_ASSERT_EQUAL_UINT32(dsc_ref.gid.index, dsc.gid.index);
+        }
+    }
+}
+
+void test_font_loader_glyph_id_cache(void)
+{
+    lv_font_t * font_bin = lv_binfont_create_from_buffer((void *)&test_font_1_buf, sizeof(test_font_1_buf));
+    TEST_ASSERT_NOT_NULL(font_bin);
+    check_glyph_ids(&test_font_1, font_bin);
+
+    const void * dsc = font_bin->dsc;
+    lv_binfont_destroy(font_bin);
+
+#if LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE > 0
+    /*The freed descriptor can be allocated again for another font*/
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_GLYPH_ID_CACHE_SIZE; i++) {
+        TEST_ASSERT_NOT_EQUAL(dsc, LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_id_cache[i].fdsc);
+    }
+#else
+    LV_UNUSED(dsc);
+#endif
+
+    font_bin = lv_binfont_create_from_buffer((void *)&test_font_3_buf, sizeof(test_font_3_buf));
+    TEST_ASSERT_NOT_NULL(font_bin);
+    check_glyph_ids(&test_font_3, font_bin);
+    lv_binfont_destroy(font_bin);
+}
+
+void test_font_loader_glyph_cache(void)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0 && LV_USE_SNAPSHOT
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache;
+    while(lv_cache_evict_one(cache, NULL));
+
+    /*A compressed font*/
+    lv_font_t * font_bin = lv_binfont_create_from_buffer((void *)&test_font_1_buf, sizeof(test_font_1_buf));
+    TEST_ASSERT_NOT_NULL(font_bin);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font_bin, 0);
+    lv_label_set_text(label, "The quick brown fox\njumps over the lazy dog");
+
+    lv_draw_buf_t * snapshot1 = lv_snapshot_take(label, LV_COLOR_FORMAT_XRGB8888);
+    size_t cache_size = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, cache_size);
+
+    /*Drawn from the cache*/
+    lv_draw_buf_t * snapshot2 = lv_snapshot_take(label, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_MEMORY(snapshot1->data, snapshot2->data, snapshot1->data_size);
+    lv_draw_buf_destroy(snapshot2);
+
+    /*Only the glyphs of the given font are dropped*/
+    lv_obj_t * label_builtin = lv_label_create(lv_screen_active());
+    lv_label_set_text(label_builtin, "The quick brown fox");
+    lv_draw_buf_destroy(lv_snapshot_take(label_builtin, LV_COLOR_FORMAT_XRGB8888));
+    size_t cache_size_builtin = lv_cache_get_size(cache, NULL) - cache_size;
+    TEST_ASSERT_GREATER_THAN(0, cache_size_builtin);
+    lv_font_clear_glyph_cache_fmt_txt(font_bin);
+    TEST_ASSERT_EQUAL(cache_size_builtin, lv_cache_get_size(cache, NULL));
+    lv_font_clear_glyph_cache_fmt_txt(lv_obj_get_style_text_font(label_builtin, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+    lv_obj_delete(label_builtin);
+
+    /*Drawn without the cache*/
+    lv_cache_set_max_size(cache, 0, NULL);
+    snapshot2 = lv_snapshot_take(label, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_MEMORY(snapshot1->data, snapshot2->data, snapshot1->data_size);
+    lv_draw_buf_destroy(snapshot2);
+    lv_cache_set_max_size(cache, LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, NULL);
+
+    /*All the glyphs are released after drawing*/
+    lv_draw_buf_destroy(lv_snapshot_take(label, LV_COLOR_FORMAT_XRGB8888));
+    TEST_ASSERT_EQUAL(cache_size, lv_cache_get_size(cache, NULL));
+    while(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+
+    lv_draw_buf_destroy(snapshot1);
+    lv_obj_delete(label);
+    lv_binfont_destroy(font_bin);
+#endif
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
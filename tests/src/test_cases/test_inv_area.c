@@ -0,0 +1,105 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static void invalidate(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_inv_area(NULL, &a);
+}
+
+static lv_display_inv_stats_t refresh(void)
+{
+    lv_display_inv_stats_t stats;
+    lv_refr_now(NULL);
+    lv_display_get_inv_stats(NULL, &stats);
+    return stats;
+}
+
+void setUp(void)
+{
+    /*Refresh everything which is pending*/
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_inv_area_overlapping_areas_are_merged(void)
+{
+    invalidate(0, 0, 19, 9);
+    invalidate(10, 0, 29, 9);
+    invalidate(5, 2, 8, 4);     /*Inside the first area*/
+
+    lv_display_inv_stats_t stats = refresh();
+    TEST_ASSERT_EQUAL_UINT32(1, stats.area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(30 * 10, stats.px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.px_saved);
+}
+
+void test_inv_area_distant_areas_are_kept(void)
+{
+    invalidate(0, 0, 9, 9);
+    invalidate(100, 100, 109, 109);
+
+    lv_display_inv_stats_t stats = refresh();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 10 * 10, stats.px_cnt);
+}
+
+void test_inv_area_many_small_areas(void)
+{
+    /*More areas than LV_INV_BUF_SIZE should not cause a full screen refresh*/
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 8; y++) {
+        for(x = 0; x < 10; x++) {
+            invalidate(x * 40, y * 40, x * 40 + 9, y * 40 + 9);
+            cnt++;
+        }
+    }
+
+    lv_display_inv_stats_t stats = refresh();
+    uint32_t scr_size = lv_display_get_horizontal_resolution(NULL) * lv_display_get_vertical_resolution(NULL);
+    TEST_ASSERT_EQUAL_UINT32(cnt, stats.area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt * 10 * 10, stats.px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(scr_size - stats.px_cnt, stats.px_saved);
+}
+
+void test_inv_area_limit(void)
+{
+    /*Above the limit the areas are merged*/
+    uint32_t i;
+    for(i = 0; i < LV_INV_AREA_MAX_CNT + 20; i++) {
+        int32_t x = (i % 40) * 20;
+        int32_t y = (i / 40) * 20;
+        invalidate(x, y, x + 1, y + 1);
+    }
+
+    lv_display_inv_stats_t stats = refresh();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_INV_AREA_MAX_CNT, stats.area_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32((LV_INV_AREA_MAX_CNT + 20) * 2 * 2, stats.px_cnt);
+}
+
+void test_inv_area_stats_total(void)
+{
+    lv_display_inv_stats_t stats_start;
+    lv_display_get_inv_stats(NULL, &stats_start);
+
+    /*More than LV_INV_BUF_SIZE (32) areas*/
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        invalidate(i * 20, 0, i * 20 + 4, 4);
+    }
+
+    lv_display_inv_stats_t stats = refresh();
+    TEST_ASSERT_NOT_EQUAL(0, stats.px_saved);
+    TEST_ASSERT_TRUE(stats_start.px_saved_total + stats.px_saved == stats.px_saved_total);
+}
+
+#endif
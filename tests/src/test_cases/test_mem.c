@@ -24,4 +24,130 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+
+static const lv_mem_class_monitor_t * get_class(lv_mem_monitor_t * mon, size_t size)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        if(size <= mon->classes[i].size) return &mon->classes[i];
+    }
+    return NULL;
+}
+
+#endif
+
+/*The test runner lists all the test functions so they are guarded inside*/
+void test_mem_thread_cache_reuse(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+    size_t free_start = lv_mem_get_free_size_with_headers();
+
+    void * buf1 = lv_malloc(40);
+    lv_free(buf1);
+    void * buf2 = lv_malloc(40);
+    TEST_ASSERT_EQUAL_PTR(buf1, buf2);
+    lv_free(buf2);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(get_class(&mon_start, 40)->alloc_cnt + 2, get_class(&mon, 40)->alloc_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(get_class(&mon_start, 40)->hit_cnt + 1, get_class(&mon, 40)->hit_cnt);
+
+    /*The cache of this thread is given back to the heap by lv_mem_monitor()*/
+    TEST_ASSERT_EQUAL(free_start, lv_mem_get_free_size_with_headers());
+#endif
+}
+
+void test_mem_thread_cache_limit(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    void * bufs[LV_MEM_THREAD_CACHE * 3];
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_CACHE * 3; i++) {
+        bufs[i] = lv_malloc(100);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        lv_memset(bufs[i], 0xaa, 100);
+    }
+
+    for(i = 0; i < LV_MEM_THREAD_CACHE * 3; i++) {
+        lv_free(bufs[i]);
+    }
+
+    /*Only one thread is used in the tests*/
+    lv_mem_thread_cache_t * cache = LV_GLOBAL_DEFAULT()->tlsf_state.thread_cache_head;
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_NULL(cache->next);
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_MEM_THREAD_CACHE, cache->cached_cnt[i]);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_thread_cache_large_blocks(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+    size_t free_start = lv_mem_get_free_size_with_headers();
+
+    /*Not cached, given back to the heap*/
+    void * buf = lv_malloc(2000);
+    lv_free(buf);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.cached_size, mon.cached_size);
+    TEST_ASSERT_EQUAL(free_start, lv_mem_get_free_size_with_headers());
+#endif
+}
+
+void test_mem_thread_cache_release(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    void * buf = lv_malloc(40);
+    lv_free(buf);
+    TEST_ASSERT_NOT_NULL(LV_GLOBAL_DEFAULT()->tlsf_state.thread_cache_head);
+
+    /*Like an exiting thread*/
+    lv_mem_thread_cache_release();
+    TEST_ASSERT_NULL(LV_GLOBAL_DEFAULT()->tlsf_state.thread_cache_head);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    /*A new cache is created on the next allocation*/
+    buf = lv_malloc(40);
+    lv_free(buf);
+    TEST_ASSERT_NOT_NULL(LV_GLOBAL_DEFAULT()->tlsf_state.thread_cache_head);
+#endif
+}
+
+void test_mem_thread_cache_remove_pool(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_MEM_THREAD_CACHE
+    static uint8_t pool_mem[16 * 1024];
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    lv_mem_pool_t pool = lv_mem_add_pool(pool_mem, sizeof(pool_mem));
+    TEST_ASSERT_NOT_NULL(pool);
+
+    /*Fill the cache of this thread with blocks, some of them might be in the new pool*/
+    void * bufs[LV_MEM_THREAD_CACHE];
+    uint32_t i;
+    for(i = 0; i < LV_MEM_THREAD_CACHE; i++) bufs[i] = lv_malloc(40);
+    for(i = 0; i < LV_MEM_THREAD_CACHE; i++) lv_free(bufs[i]);
+
+    lv_mem_remove_pool(pool);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.total_size, mon.total_size);
+#endif
+}
+
 #endif
@@ -225,6 +225,117 @@ void test_observer_group(void)
     TEST_ASSERT_EQUAL(3, group_observer_called);
 }
 
+static uint32_t int_observer_called;
+
+static void int_observer_count_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    observer_int(observer, subject);
+    int_observer_called++;
+}
+
+void test_observer_batch(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 1);
+
+    int_observer_called = 0;
+    lv_subject_add_observer(&subject, int_observer_count_cb, NULL);
+    TEST_ASSERT_EQUAL(1, int_observer_called);
+
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 2);
+    lv_subject_set_int(&subject, 3);
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 4);
+    lv_subject_batch_end();
+    TEST_ASSERT_EQUAL(4, lv_subject_get_int(&subject));
+    TEST_ASSERT_EQUAL(1, int_observer_called);
+
+    /*Notified only once with the last value at the end of the outermost batch*/
+    lv_subject_batch_end();
+    TEST_ASSERT_EQUAL(2, int_observer_called);
+    TEST_ASSERT_EQUAL(4, current_v);
+
+    /*A group is notified only once too*/
+    static lv_subject_t subject_main;
+    static lv_subject_t subject_sub1;
+    static lv_subject_t subject_sub2;
+    static lv_subject_t * subject_list[2] = {&subject_sub1, &subject_sub2};
+    lv_subject_init_int(&subject_sub1, 1);
+    lv_subject_init_int(&subject_sub2, 2);
+    lv_subject_init_group(&subject_main, subject_list, 2);
+
+    group_observer_called = 0;
+    lv_subject_add_observer(&subject_main, group_observer_cb, NULL);
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject_sub1, 10);
+    lv_subject_set_int(&subject_sub2, 20);
+    lv_subject_set_int(&subject_sub1, 11);
+    lv_subject_batch_end();
+    TEST_ASSERT_EQUAL(2, group_observer_called);
+
+    /*Not notified after the batch is ended*/
+    lv_subject_batch_end();
+    lv_subject_set_int(&subject, 5);
+    TEST_ASSERT_EQUAL(3, int_observer_called);
+}
+
+void test_observer_deferred(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 1);
+    lv_subject_set_deferred(&subject, true);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_bind_text(label, &subject, "%d");
+    int_observer_called = 0;
+    lv_subject_add_observer(&subject, int_observer_count_cb, NULL);
+    TEST_ASSERT_EQUAL(1, int_observer_called);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 200; i++) lv_subject_set_int(&subject, i);
+    TEST_ASSERT_EQUAL(1, int_observer_called);
+    TEST_ASSERT_EQUAL_STRING("1", lv_label_get_text(label));
+
+    /*Notified only once before the refresh*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, int_observer_called);
+    TEST_ASSERT_EQUAL(199, current_v);
+    TEST_ASSERT_EQUAL_STRING("199", lv_label_get_text(label));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, int_observer_called);
+
+    /*The deferred subjects are not notified at the end of a batch*/
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 5);
+    lv_subject_batch_end();
+    TEST_ASSERT_EQUAL(2, int_observer_called);
+
+    /*The pending notification is delivered when deferring is disabled*/
+    lv_subject_set_deferred(&subject, false);
+    TEST_ASSERT_EQUAL(3, int_observer_called);
+    TEST_ASSERT_EQUAL_STRING("5", lv_label_get_text(label));
+    lv_subject_set_int(&subject, 6);
+    TEST_ASSERT_EQUAL(4, int_observer_called);
+
+    /*A deinitialized subject is not notified anymore*/
+    static lv_subject_t subject2;
+    lv_subject_init_int(&subject2, 1);
+    lv_subject_set_deferred(&subject, true);
+    lv_subject_set_deferred(&subject2, true);
+    lv_subject_set_int(&subject2, 2);
+    lv_subject_set_int(&subject, 7);
+    lv_subject_deinit(&subject2);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(5, int_observer_called);
+    TEST_ASSERT_EQUAL_STRING("7", lv_label_get_text(label));
+
+    lv_obj_delete(label);
+    lv_subject_deinit(&subject);
+}
+
 void test_observer_obj_flag(void)
 {
     lv_obj_t * obj = lv_obj_create(lv_screen_active());
@@ -61,6 +61,9 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
+    /*The rendered glyphs are kept by the glyph cache*/
+    lv_font_clear_glyph_cache_fmt_txt(&lv_font_montserrat_28);
+
     lv_mem_monitor(&monitor);
     final_available_memory = monitor.free_size;
     lv_obj_delete(label);
@@ -87,6 +87,55 @@ void test_const_style(void)
     TEST_ASSERT_EQUAL(50, lv_obj_get_style_height(obj, LV_PART_MAIN));
 }
 
+/*Not in the order of the IDs on purpose*/
+#define FROZEN_STYLE_PROPS(PROP, ctx)                           \
+    PROP(ctx, GRID_CELL_Y_ALIGN, LV_GRID_ALIGN_END)             \
+    PROP(ctx, BG_COLOR, LV_COLOR_MAKE(0x11, 0x22, 0x33))        \
+    PROP(ctx, WIDTH, 51)                                        \
+    PROP(ctx, TRANSLATE_X, -7)                                  \
+    PROP(ctx, HEIGHT, 50)                                       \
+    PROP(ctx, TEXT_FONT, &lv_font_montserrat_14)
+
+LV_STYLE_CONST_FROZEN_INIT(frozen_style, FROZEN_STYLE_PROPS);
+
+void test_frozen_style(void)
+{
+    TEST_ASSERT_TRUE(lv_style_is_const(&frozen_style));
+    TEST_ASSERT_TRUE(lv_style_is_frozen(&frozen_style));
+
+    /*The properties are sorted*/
+    const lv_style_const_prop_t * props = lv_style_get_const_props(&frozen_style);
+    uint32_t i;
+    for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
+        if(i > 0) TEST_ASSERT_LESS_THAN(props[i].prop, props[i - 1].prop);
+    }
+    TEST_ASSERT_EQUAL(6, i);
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&frozen_style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(51, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&frozen_style, LV_STYLE_TRANSLATE_X, &v));
+    TEST_ASSERT_EQUAL(-7, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&frozen_style, LV_STYLE_GRID_CELL_Y_ALIGN, &v));
+    TEST_ASSERT_EQUAL(LV_GRID_ALIGN_END, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&frozen_style, LV_STYLE_MIN_WIDTH, &v));
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&frozen_style, LV_STYLE_GRID_CELL_X_ALIGN, &v));
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &frozen_style, LV_PART_INDICATOR);
+    TEST_ASSERT_EQUAL(51, lv_obj_get_style_width(obj, LV_PART_INDICATOR));
+    TEST_ASSERT_EQUAL(50, lv_obj_get_style_height(obj, LV_PART_INDICATOR));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_bg_color(obj, LV_PART_INDICATOR));
+    TEST_ASSERT_EQUAL_PTR(&lv_font_montserrat_14, lv_obj_get_style_text_font(obj, LV_PART_INDICATOR));
+    TEST_ASSERT_TRUE(lv_obj_has_style_prop(obj, LV_PART_INDICATOR, LV_STYLE_TRANSLATE_X));
+    TEST_ASSERT_FALSE(lv_obj_has_style_prop(obj, LV_PART_INDICATOR, LV_STYLE_BG_OPA));
+
+    /*Can't be modified*/
+    lv_style_set_width((lv_style_t *)&frozen_style, 10);
+    TEST_ASSERT_EQUAL(51, lv_obj_get_style_width(obj, LV_PART_INDICATOR));
+    lv_obj_delete(obj);
+}
+
 void test_style_replacement(void)
 {
     /*Define styles*/
@@ -114,6 +163,8 @@ void test_style_replacement(void)
     TEST_ASSERT_EQUAL(false, replaced);
     TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
 
+    /*The styles are on the stack, don't leave them on an object*/
+    lv_obj_delete(obj);
     lv_style_reset(&style_red);
     lv_style_reset(&style_blue);
 }
@@ -138,7 +189,89 @@ void test_style_has_prop(void)
     TEST_ASSERT_EQUAL(true, lv_obj_has_style_prop(obj, LV_PART_MAIN, LV_STYLE_OUTLINE_WIDTH));
     TEST_ASSERT_EQUAL(false, lv_obj_has_style_prop(obj, LV_PART_INDICATOR, LV_STYLE_OUTLINE_COLOR));
 
+    lv_obj_delete(obj);
+    lv_style_reset(&style);
+}
+
+void test_style_shared_style_modified(void)
+{
+    /*Modifying a style should be visible in all objects even without reporting the change*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    lv_obj_t * obj1 = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj2 = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj1, &style, 0);
+    lv_obj_add_style(obj2, &style, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj1, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj2, 0));
+
+    lv_style_set_bg_color(&style, lv_color_hex(0x00ff00));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj1, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj2, 0));
+
+    /*A local property affects only its object*/
+    lv_obj_set_style_bg_color(obj1, lv_color_hex(0x0000ff), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj1, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj2, 0));
+
+    lv_obj_remove_local_style_prop(obj1, LV_STYLE_BG_COLOR, 0);
+    lv_style_remove_prop(&style, LV_STYLE_BG_COLOR);
+    lv_color_t def_color = lv_style_prop_get_default(LV_STYLE_BG_COLOR).color;
+    lv_obj_remove_style_all(obj1);
+    TEST_ASSERT_EQUAL_COLOR(def_color, lv_obj_get_style_bg_color(obj1, 0));
+
+    /*The theme's color is used again*/
+    lv_obj_t * obj3 = lv_obj_create(lv_screen_active());
+    TEST_ASSERT_EQUAL_COLOR(lv_obj_get_style_bg_color(obj3, 0), lv_obj_get_style_bg_color(obj2, 0));
+
+    lv_obj_delete(obj1);
+    lv_obj_delete(obj2);
+    lv_obj_delete(obj3);
     lv_style_reset(&style);
 }
 
+void test_style_states_and_parts(void)
+{
+    static lv_style_t style_def;
+    static lv_style_t style_pr;
+    lv_style_init(&style_def);
+    lv_style_init(&style_pr);
+    lv_style_set_border_width(&style_def, 3);
+    lv_style_set_border_width(&style_pr, 7);
+    lv_style_set_text_color(&style_pr, lv_color_hex(0x123456));
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_t * label = lv_label_create(obj);
+
+    lv_obj_add_style(obj, &style_def, 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    lv_obj_add_style(obj, &style_def, LV_PART_SCROLLBAR);
+
+    /*Read the values in many states and parts to use more combinations than cached*/
+    static const lv_state_t states[] = {LV_STATE_DEFAULT, LV_STATE_PRESSED, LV_STATE_FOCUSED,
+                                        LV_STATE_PRESSED | LV_STATE_FOCUSED, LV_STATE_CHECKED, LV_STATE_PRESSED
+                                       };
+    uint32_t i;
+    for(i = 0; i < sizeof(states) / sizeof(states[0]); i++) {
+        lv_obj_set_state(obj, LV_STATE_ANY, false);
+        lv_obj_set_state(obj, states[i], true);
+        bool pr = states[i] & LV_STATE_PRESSED;
+        TEST_ASSERT_EQUAL_INT32(pr ? 7 : 3, lv_obj_get_style_border_width(obj, 0));
+        TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+        TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_border_width(obj, LV_PART_KNOB));
+
+        /*Inherited from the parent's current state*/
+        lv_color_t text_color = lv_obj_get_style_text_color(label, 0);
+        if(pr) TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), text_color);
+        else TEST_ASSERT_NOT_EQUAL(0x123456, lv_color_to_u32(text_color) & 0xffffff);
+    }
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style_def);
+    lv_style_reset(&style_pr);
+}
+
 #endif
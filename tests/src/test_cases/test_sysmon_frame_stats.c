@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_SYSMON_FRAME_STATS_CNT
+
+static uint32_t profiler_tick;
+
+static uint32_t get_tick_cb(void)
+{
+    /*Every call takes 1 us*/
+    return profiler_tick++;
+}
+
+static void flush_cb(const char * buf)
+{
+    LV_UNUSED(buf);
+}
+
+static void invalidate(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a = {x1, y1, x2, y2};
+    lv_inv_area(NULL, &a);
+}
+
+void setUp(void)
+{
+    lv_refr_now(NULL);
+    lv_sysmon_clear_frame_stats(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_sysmon_frame_stats_counters(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 50);
+    lv_obj_set_pos(obj, 10, 20);
+    lv_refr_now(NULL);
+
+    lv_sysmon_frame_stats_t stats[LV_SYSMON_FRAME_STATS_CNT];
+    uint32_t cnt = lv_sysmon_get_frame_stats(NULL, stats, LV_SYSMON_FRAME_STATS_CNT);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+
+    lv_display_inv_stats_t inv_stats;
+    lv_display_get_inv_stats(NULL, &inv_stats);
+    TEST_ASSERT_EQUAL_UINT32(inv_stats.area_cnt, stats[0].area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(inv_stats.px_cnt, stats[0].px_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats[0].flush_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[0].task_cnt);
+
+    /*All the draw tasks are taken by a draw unit*/
+    uint32_t unit_task_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_SYSMON_FRAME_STATS_UNIT_CNT; i++) {
+        unit_task_cnt += stats[0].units[i].task_cnt;
+    }
+    TEST_ASSERT_NOT_NULL(stats[0].units[0].name);
+    TEST_ASSERT_EQUAL_UINT32(stats[0].task_cnt, unit_task_cnt);
+}
+
+void test_sysmon_frame_stats_only_redraws_are_saved(void)
+{
+    lv_refr_now(NULL);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_sysmon_get_frame_stats(NULL, NULL, 0));
+
+    invalidate(0, 0, 9, 9);
+    lv_refr_now(NULL);
+    lv_sysmon_frame_stats_t stats;
+    TEST_ASSERT_EQUAL_UINT32(1, lv_sysmon_get_frame_stats(NULL, &stats, 1));
+    TEST_ASSERT_EQUAL_UINT32(100, stats.px_cnt);
+}
+
+void test_sysmon_frame_stats_ring_buffer(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_SYSMON_FRAME_STATS_CNT + 3; i++) {
+        invalidate(0, 0, i, 0);
+        lv_refr_now(NULL);
+    }
+
+    lv_sysmon_frame_stats_t stats[LV_SYSMON_FRAME_STATS_CNT];
+    uint32_t cnt = lv_sysmon_get_frame_stats(NULL, stats, LV_SYSMON_FRAME_STATS_CNT);
+    TEST_ASSERT_EQUAL_UINT32(LV_SYSMON_FRAME_STATS_CNT, cnt);
+
+    /*The oldest first*/
+    for(i = 0; i < cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i + 4, stats[i].px_cnt);
+        if(i > 0) TEST_ASSERT_EQUAL_UINT32(stats[i - 1].id + 1, stats[i].id);
+    }
+
+    /*Only the last ones if the buffer is small*/
+    cnt = lv_sysmon_get_frame_stats(NULL, stats, 2);
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SYSMON_FRAME_STATS_CNT + 2, stats[0].px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SYSMON_FRAME_STATS_CNT + 3, stats[1].px_cnt);
+}
+
+void test_sysmon_frame_stats_times(void)
+{
+    /*Use the tick source of the profiler*/
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(false);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_center(obj);
+    lv_refr_now(NULL);
+    lv_obj_set_x(obj, 30);
+    lv_refr_now(NULL);
+
+    lv_sysmon_frame_stats_t stats[2];
+    uint32_t cnt = lv_sysmon_get_frame_stats(NULL, stats, 2);
+
+    /*Restore the default profiler*/
+    lv_profiler_builtin_config_init(&config);
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(false);
+
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[1].interval_us);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[1].layout_us);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[1].render_us);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[1].draw_create_us);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats[1].flush_cb_us);
+
+    /*The draw tasks are rendered by the software draw units*/
+    uint32_t exec_us = 0;
+    uint32_t i;
+    for(i = 0; i < LV_SYSMON_FRAME_STATS_UNIT_CNT; i++) {
+        exec_us += stats[1].units[i].exec_us;
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, exec_us);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats[1].layout_us + stats[1].render_us, stats[1].total_us);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats[1].draw_create_us + stats[1].draw_wait_us + stats[1].flush_cb_us,
+                                        stats[1].render_us);
+}
+
+#endif /*LV_SYSMON_FRAME_STATS_CNT*/
+
+#endif
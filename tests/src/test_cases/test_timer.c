@@ -0,0 +1,177 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TIMER_CNT 200
+
+static uint32_t run_cnt[TIMER_CNT];
+static lv_timer_t * timer_to_delete;
+static lv_timer_t * created_timer;
+
+static void count_cb(lv_timer_t * timer)
+{
+    uint32_t * cnt = lv_timer_get_user_data(timer);
+    (*cnt)++;
+}
+
+static void delete_other_cb(lv_timer_t * timer)
+{
+    count_cb(timer);
+    if(timer_to_delete) {
+        lv_timer_delete(timer_to_delete);
+        timer_to_delete = NULL;
+    }
+}
+
+static void create_other_cb(lv_timer_t * timer)
+{
+    count_cb(timer);
+    if(created_timer == NULL) created_timer = lv_timer_create(count_cb, 0, &run_cnt[2]);
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    count_cb(timer);
+    lv_timer_delete(timer);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    lv_memzero(run_cnt, sizeof(run_cnt));
+    timer_to_delete = NULL;
+    created_timer = NULL;
+}
+
+void tearDown(void)
+{
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        lv_timer_t * next = lv_timer_get_next(timer);
+        if(lv_timer_get_user_data(timer) >= (void *)run_cnt &&
+           lv_timer_get_user_data(timer) < (void *)&run_cnt[TIMER_CNT]) {
+            lv_timer_delete(timer);
+        }
+        timer = next;
+    }
+}
+
+void test_timer_should_run_each_timer_in_its_period(void)
+{
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        lv_timer_create(count_cb, i + 1, &run_cnt[i]);
+    }
+
+    for(i = 0; i < 1000; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+
+    for(i = 0; i < TIMER_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 / (i + 1), run_cnt[i]);
+    }
+}
+
+void test_timer_should_return_the_time_until_the_next_timer(void)
+{
+    lv_timer_create(count_cb, 5, &run_cnt[0]);
+    lv_timer_t * timer = lv_timer_create(count_cb, 3, &run_cnt[1]);
+    lv_timer_handler();
+
+    TEST_ASSERT_EQUAL_UINT32(3, lv_timer_get_time_until_next());
+
+    lv_tick_inc(2);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_timer_handler());
+
+    /*The paused timers don't count*/
+    lv_timer_pause(timer);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_timer_handler());
+
+    lv_timer_resume(timer);
+    lv_timer_ready(timer);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+
+    lv_timer_set_period(timer, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_timer_handler());
+
+    lv_timer_reset(timer);
+    lv_timer_set_period(timer, 100);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+}
+
+void test_timer_should_run_at_most_once_per_call(void)
+{
+    lv_timer_create(count_cb, 0, &run_cnt[0]);
+    lv_timer_handler();
+    lv_timer_handler();
+
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+}
+
+void test_timer_should_handle_the_repeat_count(void)
+{
+    lv_timer_t * timer = lv_timer_create(count_cb, 10, &run_cnt[0]);
+    lv_timer_set_repeat_count(timer, 2);
+
+    lv_timer_t * timer_keep = lv_timer_create(count_cb, 10, &run_cnt[1]);
+    lv_timer_set_repeat_count(timer_keep, 1);
+    lv_timer_set_auto_delete(timer_keep, false);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    TEST_ASSERT_FALSE(timer_exists(timer));
+
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_TRUE(timer_exists(timer_keep));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timer_keep));
+}
+
+void test_timer_should_handle_timers_created_and_deleted_in_callbacks(void)
+{
+    lv_timer_t * timer_self = lv_timer_create(delete_self_cb, 0, &run_cnt[3]);
+    lv_timer_create(delete_other_cb, 10, &run_cnt[0]);
+    lv_timer_create(create_other_cb, 10, &run_cnt[1]);
+    timer_to_delete = lv_timer_create(count_cb, 10, &run_cnt[4]);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+
+    /*The new timer is ready immediately so it runs in the same call*/
+    TEST_ASSERT_NOT_NULL(created_timer);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_FALSE(timer_exists(timer_self));
+    TEST_ASSERT_NULL(timer_to_delete);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, run_cnt[4]);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, run_cnt[4]);
+}
+
+#endif
@@ -157,4 +157,42 @@ void test_canvas_fill_and_set_px(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/canvas_1.png");
 }
 
+void test_canvas_get_px_rgb565(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+
+    LV_DRAW_BUF_DEFINE_STATIC(buf_rgb565, 10, 10, LV_COLOR_FORMAT_RGB565);
+    LV_DRAW_BUF_INIT_STATIC(buf_rgb565);
+    canvas_draw_buf_reshape(&buf_rgb565);
+    lv_canvas_set_draw_buf(canvas, &buf_rgb565);
+    lv_canvas_fill_bg(canvas, lv_color_hex(0x000000), LV_OPA_COVER);
+
+    lv_canvas_set_px(canvas, 0, 0, lv_color_hex(0xff0000), LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 4, 2, lv_color_hex(0x00ff00), LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 9, 7, lv_color_hex(0x0000ff), LV_OPA_COVER);
+
+    lv_color32_t c = lv_canvas_get_px(canvas, 0, 0);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.green);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.blue);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.alpha);
+
+    c = lv_canvas_get_px(canvas, 4, 2);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.red);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.green);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.blue);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.alpha);
+
+    c = lv_canvas_get_px(canvas, 9, 7);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.red);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.green);
+    TEST_ASSERT_EQUAL_UINT8(0xff, c.blue);
+
+    /*The neighbours of the set pixels stay black*/
+    c = lv_canvas_get_px(canvas, 8, 7);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.blue);
+    c = lv_canvas_get_px(canvas, 5, 2);
+    TEST_ASSERT_EQUAL_UINT8(0x00, c.green);
+}
+
 #endif
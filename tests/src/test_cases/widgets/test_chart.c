@@ -193,4 +193,88 @@ void test_draw_task_hooking(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_bar_draw_hook.png");
 }
 
+static int32_t get_invalidated_width(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    int32_t w = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0) w += lv_area_get_width(&disp->inv_areas[i]);
+    }
+    return w;
+}
+
+void test_chart_crowded_line_should_be_updated_locally(void)
+{
+#if LV_USE_SNAPSHOT
+    lv_obj_set_size(chart, 300, 200);
+    lv_chart_set_point_count(chart, 5000);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < 5000; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_chart_set_next_value(chart, ser, (seed >> 16) % 100);
+    }
+    lv_refr_now(NULL);
+
+    /*Only a narrow strip around the new points is redrawn*/
+    for(i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_chart_set_next_value(chart, ser, (seed >> 16) % 100);
+        if(i % 30 == 0) {
+            TEST_ASSERT_LESS_THAN_INT32(30, get_invalidated_width());
+            lv_refr_now(NULL);
+        }
+    }
+    lv_chart_set_value_by_id(chart, ser, 4999, LV_CHART_POINT_NONE);
+
+    /*The locally updated min-max ranges are the same as the recalculated ones*/
+    lv_draw_buf_t * updated = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(updated);
+    lv_chart_refresh(chart);
+    lv_draw_buf_t * recalculated = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(recalculated);
+
+    TEST_ASSERT_EQUAL_MEMORY(recalculated->data, updated->data, updated->data_size);
+    lv_draw_buf_destroy(updated);
+    lv_draw_buf_destroy(recalculated);
+#endif
+}
+
+static void crowded_line_draw_task_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    lv_draw_dsc_base_t * base_dsc = draw_task->draw_dsc;
+    if(draw_task->type != LV_DRAW_TASK_TYPE_LINE || base_dsc->part != LV_PART_ITEMS) return;
+
+    /*The lines are drawn from left to right, each ending on a later point*/
+    int32_t * last_id2 = lv_event_get_user_data(e);
+    TEST_ASSERT_GREATER_THAN_INT32(*last_id2, (int32_t)base_dsc->id2);
+    TEST_ASSERT_LESS_THAN_UINT32(lv_chart_get_point_count(lv_event_get_target(e)), base_dsc->id2);
+    *last_id2 = base_dsc->id2;
+}
+
+void test_chart_crowded_line_draw_tasks_have_point_ids(void)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_chart_set_point_count(chart, 5000);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 5000; i++) {
+        lv_chart_set_next_value(chart, ser, i % 100);
+    }
+
+    int32_t last_id2 = -1;
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, crowded_line_draw_task_cb, LV_EVENT_DRAW_TASK_ADDED, &last_id2);
+    lv_refr_now(NULL);
+
+    /*The last line ends on the last point*/
+    TEST_ASSERT_EQUAL_INT32(4999, last_id2);
+}
+
 #endif
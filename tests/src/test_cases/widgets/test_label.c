@@ -626,4 +626,155 @@ void test_label_with_recolor_cmd(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_recolor.png");
 }
 
+static void create_very_long_text(char * buf, uint32_t len)
+{
+    static const char * words[] = {"Lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.\n"};
+    uint32_t i = 0;
+    uint32_t w = 0;
+    buf[0] = '\0';
+    while(i + 16 < len) {
+        i += lv_snprintf(&buf[i], len - i, "%s ", words[w % 8]);
+        w += 3;
+    }
+}
+
+/* Compare the cached lines of a label with the lines broken from the start of the text */
+static void check_label_lines(lv_obj_t * obj)
+{
+    lv_obj_update_layout(obj);
+
+    lv_label_t * l = (lv_label_t *)obj;
+    const char * txt = lv_label_get_text(obj);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    int32_t max_w = lv_obj_get_content_width(obj);
+
+    TEST_ASSERT_NOT_NULL(l->lines.starts);
+
+    uint32_t line = 0;
+    uint32_t start = 0;
+    while(txt[start] != '\0') {
+        TEST_ASSERT_LESS_THAN_UINT32(l->lines.cnt, line);
+        TEST_ASSERT_EQUAL_UINT32(start, l->lines.starts[line]);
+        uint32_t end = start + lv_text_get_next_line(&txt[start], LV_TEXT_LEN_MAX, font, letter_space, max_w, NULL,
+                                                     LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_EQUAL_INT32(lv_text_get_width(&txt[start], end - start, font, letter_space), l->lines.widths[line]);
+        start = end;
+        line++;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(line, l->lines.cnt);
+    TEST_ASSERT_EQUAL_UINT32(start, l->lines.starts[line]);
+
+    lv_point_t size;
+    lv_text_get_size(&size, txt, font, letter_space, lv_obj_get_style_text_line_space(obj, LV_PART_MAIN), max_w,
+                     LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_content_height(obj));
+}
+
+void test_label_very_long_text_lines(void)
+{
+#if LV_LABEL_LONG_TXT_HINT
+    static char buf[4096];
+    create_very_long_text(buf, sizeof(buf));
+
+    lv_obj_set_width(label, 200);
+    lv_label_set_text(label, buf);
+    check_label_lines(label);
+
+    /*Break the lines again if the width changes*/
+    lv_obj_set_width(label, 150);
+    check_label_lines(label);
+
+    /*The lines are not kept in other modes*/
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    TEST_ASSERT_NULL(((lv_label_t *)label)->lines.starts);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    check_label_lines(label);
+
+    /*The letters are found the same way with and without the lines*/
+    lv_label_t * l = (lv_label_t *)label;
+    lv_label_lines_t lines = l->lines;
+    uint32_t char_id = lv_text_get_encoded_length(buf) - 100;
+    lv_point_t pos;
+    lv_point_t pos_broken;
+    lv_label_get_letter_pos(label, char_id, &pos);
+    uint32_t letter_on = lv_label_get_letter_on(label, &pos, false);
+    TEST_ASSERT_GREATER_THAN_INT32(1000, pos.y);
+
+    lv_memzero(&l->lines, sizeof(lines));
+    lv_label_get_letter_pos(label, char_id, &pos_broken);
+    TEST_ASSERT_EQUAL_INT32(pos_broken.x, pos.x);
+    TEST_ASSERT_EQUAL_INT32(pos_broken.y, pos.y);
+    TEST_ASSERT_EQUAL_UINT32(lv_label_get_letter_on(label, &pos, false), letter_on);
+    l->lines = lines;
+#endif
+}
+
+void test_label_very_long_text_edit(void)
+{
+#if LV_LABEL_LONG_TXT_HINT
+    static char buf[4096];
+    create_very_long_text(buf, sizeof(buf));
+
+    lv_obj_set_width(label, 200);
+    lv_label_set_text(label, buf);
+
+    /*Insert text that changes the line breaks in the middle, at the start and at the end*/
+    lv_label_ins_text(label, 1000, "a_very_long_word_which_does_not_fit_in_one_line_at_all ");
+    check_label_lines(label);
+    lv_label_ins_text(label, 0, "Start ");
+    check_label_lines(label);
+    lv_label_ins_text(label, LV_LABEL_POS_LAST, "End\n");
+    check_label_lines(label);
+    lv_label_ins_text(label, 2000, "\n\n");
+    check_label_lines(label);
+
+    /*Join words by deleting spaces and new lines*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        const char * txt = lv_label_get_text(label);
+        const char * space = strchr(&txt[500 + i * 100], i % 2 ? ' ' : '\n');
+        TEST_ASSERT_NOT_NULL(space);
+        lv_label_cut_text(label, space - txt, 1);
+        check_label_lines(label);
+    }
+
+    lv_label_cut_text(label, 100, 1000);
+    check_label_lines(label);
+    lv_label_cut_text(label, 0, lv_text_get_encoded_length(lv_label_get_text(label)));
+    TEST_ASSERT_EQUAL_STRING("", lv_label_get_text(label));
+#endif
+}
+
+void test_label_very_long_text_draw(void)
+{
+#if LV_LABEL_LONG_TXT_HINT && LV_USE_SNAPSHOT
+    static char buf[4096];
+    create_very_long_text(buf, sizeof(buf));
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 240, 300);
+    lv_obj_t * l = lv_label_create(cont);
+    lv_obj_set_width(l, 200);
+    lv_label_set_text(l, buf);
+    lv_obj_update_layout(cont);
+    lv_obj_scroll_to_y(cont, 1200, LV_ANIM_OFF);
+
+    /*Draw with the lines and by breaking the text from the start*/
+    lv_draw_buf_t * cached = lv_snapshot_take(cont, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(cached);
+
+    lv_label_lines_t lines = ((lv_label_t *)l)->lines;
+    lv_memzero(&((lv_label_t *)l)->lines, sizeof(lines));
+    lv_draw_buf_t * broken = lv_snapshot_take(cont, LV_COLOR_FORMAT_XRGB8888);
+    ((lv_label_t *)l)->lines = lines;
+    TEST_ASSERT_NOT_NULL(broken);
+
+    TEST_ASSERT_EQUAL_MEMORY(broken->data, cached->data, cached->data_size);
+    lv_draw_buf_destroy(cached);
+    lv_draw_buf_destroy(broken);
+#endif
+}
+
 #endif
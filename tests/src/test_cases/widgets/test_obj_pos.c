@@ -51,4 +51,70 @@ void test_content_parent_pct_child_pos_1(void)
     TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_y(child2));
 }
 
+
+static lv_obj_t * plain_obj_create(lv_obj_t * parent, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_update_layout(obj);
+    return obj;
+}
+
+void test_obj_area_is_visible_keeps_the_area_on_the_object(void)
+{
+    lv_obj_t * obj = plain_obj_create(lv_screen_active(), 100, 100, 200, 200);
+
+    /*Only a part of the object is checked, not the whole object*/
+    lv_area_t area = {150, 150, 159, 159};
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(obj, &area));
+    TEST_ASSERT_EQUAL_INT32(150, area.x1);
+    TEST_ASSERT_EQUAL_INT32(150, area.y1);
+    TEST_ASSERT_EQUAL_INT32(159, area.x2);
+    TEST_ASSERT_EQUAL_INT32(159, area.y2);
+
+    area = (lv_area_t){400, 400, 409, 409};
+    TEST_ASSERT_FALSE(lv_obj_area_is_visible(obj, &area));
+}
+
+void test_obj_area_is_visible_clips_to_the_object_and_the_parents(void)
+{
+    lv_obj_t * parent = plain_obj_create(lv_screen_active(), 100, 100, 200, 200);
+    lv_obj_t * child = plain_obj_create(parent, 50, 50, 200, 200);
+
+    lv_area_t area = {140, 140, 339, 339};
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(child, &area));
+    TEST_ASSERT_EQUAL_INT32(150, area.x1);
+    TEST_ASSERT_EQUAL_INT32(150, area.y1);
+    TEST_ASSERT_EQUAL_INT32(299, area.x2);
+    TEST_ASSERT_EQUAL_INT32(299, area.y2);
+
+    /*Only on the part of the child which is out of the parent*/
+    area = (lv_area_t){310, 310, 319, 319};
+    TEST_ASSERT_FALSE(lv_obj_area_is_visible(child, &area));
+}
+
+void test_obj_area_is_visible_keeps_the_ext_draw_area_of_the_parents_with_overflow_visible(void)
+{
+    lv_obj_t * parent = plain_obj_create(lv_screen_active(), 100, 100, 200, 200);
+    lv_obj_set_style_outline_width(parent, 10, 0);
+    lv_obj_t * child = plain_obj_create(parent, -20, 0, 50, 50);
+
+    /*Clipped to the parent*/
+    lv_area_t area = child->coords;
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(child, &area));
+    TEST_ASSERT_EQUAL_INT32(100, area.x1);
+    TEST_ASSERT_EQUAL_INT32(129, area.x2);
+
+    /*Clipped to the parent and its outline*/
+    lv_obj_add_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    area = child->coords;
+    TEST_ASSERT_TRUE(lv_obj_area_is_visible(child, &area));
+    TEST_ASSERT_EQUAL_INT32(90, area.x1);
+    TEST_ASSERT_EQUAL_INT32(100, area.y1);
+    TEST_ASSERT_EQUAL_INT32(129, area.x2);
+    TEST_ASSERT_EQUAL_INT32(149, area.y2);
+}
+
 #endif
@@ -242,6 +242,46 @@ void test_spangroup_draw(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/span_05.png");
 }
 
+void test_spangroup_layout_should_be_cached(void)
+{
+    active_screen = lv_screen_active();
+    spangroup = lv_spangroup_create(active_screen);
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    lv_spangroup_set_mode(spangroup, LV_SPAN_MODE_BREAK);
+    lv_obj_set_width(spangroup, 100);
+    lv_span_t * span = lv_spangroup_new_span(spangroup);
+    lv_span_set_text(span, "This text is over 100 pixels width");
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    uint32_t line_cnt = lv_array_size(&spans->layout_lines);
+    TEST_ASSERT_GREATER_THAN_UINT32(1, line_cnt);
+    void * lines = lv_array_front(&spans->layout_lines);
+
+    /*Redrawing only replays the layout*/
+    lv_obj_invalidate(spangroup);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    TEST_ASSERT_EQUAL_UINT32(line_cnt, lv_array_size(&spans->layout_lines));
+    TEST_ASSERT_EQUAL_PTR(lines, lv_array_front(&spans->layout_lines));
+
+    lv_span_set_text(span, "Short");
+    TEST_ASSERT_FALSE(spans->layout_valid);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_array_size(&spans->layout_lines));
+
+    lv_span_set_text(span, "This text is over 100 pixels width");
+    lv_obj_set_width(spangroup, 400);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_array_size(&spans->layout_lines));
+
+    lv_obj_set_style_text_letter_space(spangroup, 20, LV_PART_MAIN);
+    TEST_ASSERT_FALSE(spans->layout_valid);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(1, lv_array_size(&spans->layout_lines));
+}
+
 void test_spangroup_get_child(void)
 {
     const int32_t span_1_idx = 0;
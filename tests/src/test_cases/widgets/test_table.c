@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include "lv_test_indev.h"
 
 static lv_obj_t * scr = NULL;
 static lv_obj_t * table = NULL;
@@ -313,4 +314,133 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(0, selected_column);
 }
 
+static void selected_cell_event_cb(lv_event_t * e)
+{
+    uint32_t * selected_row = lv_event_get_user_data(e);
+    uint32_t col;
+    lv_table_get_selected_cell(lv_event_get_target(e), selected_row, &col);
+}
+
+void test_table_should_find_rows_with_different_heights(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    uint32_t row_cnt = 1000;
+    uint32_t i;
+
+    lv_obj_set_size(table, 200, 200);
+    lv_table_set_column_width(table, 0, 180);
+    for(i = 0; i < row_cnt; i++) {
+        lv_table_set_cell_value(table, i, 0, i % 7 == 0 ? "Multi\nline" : "Single");
+    }
+
+    int32_t sum = 0;
+    for(i = 0; i < row_cnt; i++) sum += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(sum - 1, lv_obj_get_self_height(table));
+
+    /*Press the middle of some rows after scrolling them to the top*/
+    uint32_t selected_row = LV_TABLE_CELL_NONE;
+    lv_obj_add_event_cb(table, selected_cell_event_cb, LV_EVENT_VALUE_CHANGED, &selected_row);
+
+    const uint32_t test_rows[] = {0, 1, 7, 500, 777, 996};
+    for(i = 0; i < sizeof(test_rows) / sizeof(test_rows[0]); i++) {
+        uint32_t r;
+        int32_t y = 0;
+        for(r = 0; r < test_rows[i]; r++) y += table_ptr->row_h[r];
+
+        lv_obj_scroll_to_y(table, y, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+
+        int32_t click_y = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_PART_MAIN) +
+                          y - lv_obj_get_scroll_y(table) + table_ptr->row_h[test_rows[i]] / 2;
+        lv_test_mouse_click_at(table->coords.x1 + 50, click_y);
+        TEST_ASSERT_EQUAL_UINT32(test_rows[i], selected_row);
+    }
+
+    /*The sums should remain valid after removing and adding rows*/
+    lv_table_set_row_count(table, 300);
+    lv_table_set_cell_value(table, 299, 0, "Multi\nline\ntext");
+    sum = 0;
+    for(i = 0; i < 300; i++) sum += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(sum - 1, lv_obj_get_self_height(table));
+}
+
+void test_table_virtual_mode_should_measure_only_the_rows_around_the_visible_area(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    uint32_t row_cnt = 1000;
+    uint32_t i;
+
+    lv_obj_set_size(table, 200, 200);
+    lv_table_set_column_width(table, 0, 180);
+    lv_table_set_virtual(table, true);
+    TEST_ASSERT_TRUE(lv_table_get_virtual(table));
+
+    for(i = 0; i < row_cnt; i++) {
+        lv_table_set_cell_value(table, i, 0, "Multi\nline");
+    }
+    lv_refr_now(NULL);
+
+    int32_t h_measured = table_ptr->row_h[0];
+    int32_t h_estimated = table_ptr->row_h[row_cnt - 1];
+    TEST_ASSERT_GREATER_THAN(h_estimated, h_measured);
+
+    /*The rows scrolled into view are measured*/
+    lv_obj_scroll_to_y(table, 500 * h_estimated, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    uint32_t first_visible = 0;
+    int32_t y = table_ptr->row_h[0];
+    while(y <= lv_obj_get_scroll_y(table)) {
+        first_visible++;
+        y += table_ptr->row_h[first_visible];
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(400, first_visible);
+    TEST_ASSERT_EQUAL_INT32(h_measured, table_ptr->row_h[first_visible]);
+    TEST_ASSERT_EQUAL_INT32(h_measured, table_ptr->row_h[first_visible + 200 / h_measured]);
+    TEST_ASSERT_EQUAL_INT32(h_estimated, table_ptr->row_h[row_cnt - 1]);
+
+    int32_t sum = 0;
+    for(i = 0; i < row_cnt; i++) sum += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(sum - 1, lv_obj_get_self_height(table));
+
+    /*Disabling the virtual mode measures all the rows*/
+    lv_table_set_virtual(table, false);
+    TEST_ASSERT_FALSE(lv_table_get_virtual(table));
+    for(i = 0; i < row_cnt; i++) {
+        TEST_ASSERT_EQUAL_INT32(h_measured, table_ptr->row_h[i]);
+    }
+}
+
+static const char * cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+
+    if(row == 3) return "Multi\nline";
+    if(col == 2) return NULL;
+
+    lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 ":%" LV_PRIu32, row, col);
+    return buf;
+}
+
+void test_table_should_get_cell_values_from_callback(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+
+    lv_table_set_column_count(table, 3);
+    lv_table_set_row_count(table, 100);
+    lv_table_set_cell_value(table, 0, 0, "Header");
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+
+    TEST_ASSERT_EQUAL_STRING("Header", lv_table_get_cell_value(table, 0, 0));
+    TEST_ASSERT_EQUAL_STRING("42:1", lv_table_get_cell_value(table, 42, 1));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 42, 2));
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[2], table_ptr->row_h[3]);
+
+    lv_refr_now(NULL);
+
+    lv_table_set_cell_value_cb(table, NULL);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 42, 1));
+    TEST_ASSERT_EQUAL_INT32(table_ptr->row_h[2], table_ptr->row_h[3]);
+}
+
 #endif
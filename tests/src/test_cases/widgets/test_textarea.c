@@ -213,4 +213,60 @@ void test_textarea_properties(void)
 #endif
 }
 
+static void refresh_screen(void)
+{
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_tick_inc(20);
+        lv_timer_handler();
+    }
+    lv_refr_now(NULL);
+}
+
+static int32_t get_invalidated_height(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    int32_t h = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0) h += lv_area_get_height(&disp->inv_areas[i]);
+    }
+    return h;
+}
+
+void test_textarea_should_redraw_only_the_edited_lines_of_a_long_text(void)
+{
+    static char buf[8192];
+    uint32_t i;
+    for(i = 0; i < sizeof(buf) - 1; i++) buf[i] = i % 7 == 6 ? ' ' : 'a' + i % 26;
+    buf[sizeof(buf) - 1] = '\0';
+
+    lv_obj_set_size(textarea, 300, 200);
+    lv_textarea_set_text(textarea, buf);
+    refresh_screen();
+    /*Scroll back to the top*/
+    lv_textarea_set_cursor_pos(textarea, 20);
+    refresh_screen();
+
+    const lv_font_t * font = lv_obj_get_style_text_font(textarea, LV_PART_MAIN);
+    int32_t line_h = lv_font_get_line_height(font);
+
+    lv_textarea_add_char(textarea, 'x');
+    TEST_ASSERT_LESS_THAN_INT32(4 * line_h, get_invalidated_height());
+    refresh_screen();
+
+    lv_textarea_delete_char(textarea);
+    TEST_ASSERT_LESS_THAN_INT32(4 * line_h, get_invalidated_height());
+    TEST_ASSERT_EQUAL_STRING(buf, lv_textarea_get_text(textarea));
+
+    /*The size is up to date too*/
+    lv_textarea_add_text(textarea, "\n\n\n");
+    lv_obj_t * label = lv_textarea_get_label(textarea);
+    lv_point_t size;
+    lv_text_get_size(&size, lv_label_get_text(label), font, 0, lv_obj_get_style_text_line_space(label, LV_PART_MAIN),
+                     lv_obj_get_content_width(label), LV_TEXT_FLAG_NONE);
+    lv_obj_update_layout(textarea);
+    TEST_ASSERT_EQUAL_INT32(size.y, lv_obj_get_height(label));
+}
+
 #endif
@@ -0,0 +1,171 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * list;
+static uint32_t create_cnt;
+static uint32_t bind_cnt;
+
+static lv_obj_t * create_item(lv_obj_t * obj)
+{
+    create_cnt++;
+    lv_obj_t * item = lv_obj_create(obj);
+    lv_label_create(item);
+    return item;
+}
+
+static void bind_item(lv_obj_t * obj, lv_obj_t * item, uint32_t index)
+{
+    LV_UNUSED(obj);
+    bind_cnt++;
+    lv_label_set_text_fmt(lv_obj_get_child(item, 0), "%" LV_PRIu32, index);
+}
+
+static void check_visible_items(void)
+{
+    /*Apply the positions of the rebound items*/
+    lv_obj_update_layout(list);
+
+    int32_t item_h = lv_virtuallist_get_item_height(list);
+    int32_t y = lv_obj_get_scroll_y(list) - lv_obj_get_style_pad_top(list, LV_PART_MAIN) -
+                lv_obj_get_style_border_width(list, LV_PART_MAIN);
+    uint32_t first = y > 0 ? y / item_h : 0;
+    uint32_t last = LV_MIN(first + lv_obj_get_height(list) / item_h, lv_virtuallist_get_item_count(list) - 1);
+
+    uint32_t i;
+    for(i = first; i <= last; i++) {
+        lv_obj_t * item = lv_virtuallist_get_item(list, i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_UINT32(i, lv_virtuallist_get_item_index(list, item));
+        TEST_ASSERT_EQUAL_INT32(i * item_h, lv_obj_get_y(item));
+
+        char buf[16];
+        lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32, i);
+        TEST_ASSERT_EQUAL_STRING(buf, lv_label_get_text(lv_obj_get_child(item, 0)));
+    }
+}
+
+void setUp(void)
+{
+    create_cnt = 0;
+    bind_cnt = 0;
+    list = lv_virtuallist_create(lv_screen_active());
+    lv_obj_set_size(list, 200, 300);
+    lv_virtuallist_set_item_height(list, 40);
+    lv_virtuallist_set_item_cb(list, create_item, bind_item);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_virtuallist_should_create_only_the_visible_items(void)
+{
+    lv_virtuallist_set_item_count(list, 10000);
+    lv_obj_update_layout(list);
+
+    TEST_ASSERT_EQUAL_UINT32(10000, lv_virtuallist_get_item_count(list));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(300 / 40 + 2, lv_obj_get_child_count(list));
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_child_count(list), create_cnt);
+
+    /*The scrollable area contains all the items*/
+    TEST_ASSERT_EQUAL_INT32(10000 * 40 - lv_obj_get_content_height(list), lv_obj_get_scroll_bottom(list));
+    check_visible_items();
+    TEST_ASSERT_NULL(lv_virtuallist_get_item(list, 5000));
+}
+
+void test_virtuallist_should_rebind_items_on_scroll(void)
+{
+    lv_virtuallist_set_item_count(list, 10000);
+    lv_obj_update_layout(list);
+    uint32_t child_cnt = lv_obj_get_child_count(list);
+
+    lv_obj_scroll_by(list, 0, -100, LV_ANIM_OFF);
+    check_visible_items();
+
+    /*Only the items scrolled into view are bound again*/
+    bind_cnt = 0;
+    lv_obj_scroll_by(list, 0, -40, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(1, bind_cnt);
+    check_visible_items();
+
+    lv_virtuallist_scroll_to_item(list, 5000, LV_ANIM_OFF);
+    check_visible_items();
+    TEST_ASSERT_NOT_NULL(lv_virtuallist_get_item(list, 5000));
+
+    lv_virtuallist_scroll_to_item(list, 9999, LV_ANIM_OFF);
+    check_visible_items();
+    TEST_ASSERT_NOT_NULL(lv_virtuallist_get_item(list, 9999));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(list));
+
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_count(list));
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, create_cnt);
+}
+
+void test_virtuallist_should_follow_item_count_and_size_changes(void)
+{
+    lv_virtuallist_set_item_count(list, 3);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_count(list));
+    check_visible_items();
+
+    lv_virtuallist_set_item_count(list, 1000);
+    lv_virtuallist_scroll_to_item(list, 999, LV_ANIM_OFF);
+
+    /*Scrolled back into the new range*/
+    lv_virtuallist_set_item_count(list, 20);
+    check_visible_items();
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(list));
+
+    lv_obj_set_height(list, 600);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(LV_MIN(600 / 40 + 2, 20), lv_obj_get_child_count(list));
+    check_visible_items();
+
+    lv_virtuallist_set_item_count(list, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(list));
+    TEST_ASSERT_NULL(lv_virtuallist_get_item(list, 0));
+}
+
+void test_virtuallist_should_refresh_the_items(void)
+{
+    lv_virtuallist_set_item_count(list, 100);
+    lv_obj_update_layout(list);
+
+    bind_cnt = 0;
+    lv_virtuallist_refresh(list);
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_child_count(list), bind_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_VIRTUALLIST_ITEM_NONE, lv_virtuallist_get_item_index(list, list));
+}
+
+void test_virtuallist_should_handle_deleted_items(void)
+{
+    lv_virtuallist_set_item_count(list, 100);
+    lv_obj_update_layout(list);
+    uint32_t child_cnt = lv_obj_get_child_count(list);
+
+    /*The deleted items are created again*/
+    lv_obj_delete(lv_virtuallist_get_item(list, 1));
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_count(list));
+    TEST_ASSERT_EQUAL_UINT32(child_cnt + 1, create_cnt);
+    check_visible_items();
+
+    lv_obj_clean(list);
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_count(list));
+    check_visible_items();
+
+    /*A moved item is not used anymore*/
+    lv_obj_t * item = lv_virtuallist_get_item(list, 0);
+    lv_obj_set_parent(item, lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(LV_VIRTUALLIST_ITEM_NONE, lv_virtuallist_get_item_index(list, item));
+    check_visible_items();
+
+    lv_virtuallist_scroll_to_item(list, 99, LV_ANIM_OFF);
+    check_visible_items();
+    lv_obj_delete(list);
+}
+
+#endif